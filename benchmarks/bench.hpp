@@ -0,0 +1,65 @@
+#ifndef SHARED_RESOURCES_BENCHMARKS_BENCH_HPP
+#define SHARED_RESOURCES_BENCHMARKS_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench
+{
+///
+/// @brief Keeps a value alive so the compiler cannot drop the computation producing it
+///
+inline volatile long long sink = 0;
+
+///
+/// @brief Runs a function repeatedly and prints the mean time of one run
+/// @param name The name to print
+/// @param runs The number of runs
+/// @param function The function to run, called with the index of the run
+/// @return The mean time of one run in nanoseconds
+///
+template <typename Function>
+double run(char const *name, std::size_t runs, Function &&function)
+{
+    // One untimed run warms up the code and whatever data the function does not evict itself
+    function(std::size_t{ 0 });
+
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < runs; ++i)
+    {
+        function(i);
+    }
+    auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    double const mean = elapsed / static_cast<double>(runs);
+    std::printf("%-40s %12.2f ns\n", name, mean);
+    return mean;
+}
+///
+/// @brief Runs a function repeatedly after an untimed setup each time, and prints the mean time of one run
+/// @param name The name to print
+/// @param runs The number of runs
+/// @param setup The function to run before each run, e.g. to evict the caches
+/// @param function The function to run, called with the index of the run
+/// @return The mean time of one run in nanoseconds
+///
+template <typename Setup, typename Function>
+double run(char const *name, std::size_t runs, Setup &&setup, Function &&function)
+{
+    double elapsed = 0;
+    for (std::size_t i = 0; i < runs; ++i)
+    {
+        setup();
+        auto const start = std::chrono::steady_clock::now();
+        function(i);
+        elapsed += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double const mean = elapsed / static_cast<double>(runs);
+    std::printf("%-40s %12.2f ns\n", name, mean);
+    return mean;
+}
+}  // namespace bench
+
+#endif  // SHARED_RESOURCES_BENCHMARKS_BENCH_HPP
@@ -0,0 +1,143 @@
+#include "bench.hpp"
+
+#include <shared_resources/kernel.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+///
+/// @brief A function table with one variant per instruction set level
+///
+struct sum_kernels
+{
+    int (*sum)(int const *values, std::size_t size);
+};
+
+int sum_baseline(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define SRS_BENCH_X86 1
+__attribute__((target("sse2"))) int sum_sse2(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+
+__attribute__((target("avx2"))) int sum_avx2(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+
+__attribute__((target("avx512f"))) int sum_avx512(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+#else
+#define SRS_BENCH_X86 0
+int sum_sse2(int const *values, std::size_t size)
+{
+    return sum_baseline(values, size);
+}
+
+int sum_avx2(int const *values, std::size_t size)
+{
+    return sum_baseline(values, size);
+}
+
+int sum_avx512(int const *values, std::size_t size)
+{
+    return sum_baseline(values, size);
+}
+#endif
+
+///
+/// @brief Selects the variant on every call, as code without a kernel slot would
+///
+int sum_dispatch(int const *values, std::size_t size)
+{
+#if SRS_BENCH_X86
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return sum_avx512(values, size);
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return sum_avx2(values, size);
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return sum_sse2(values, size);
+    }
+#endif
+    return sum_baseline(values, size);
+}
+
+///
+/// @brief Times summing arrays of one size with every variant and both dispatch strategies
+/// @param size The number of values summed per call
+///
+void compare(std::size_t size)
+{
+    using kernels = srs::kernel<sum_kernels>;
+    srs::shared_resources<srs::type_list<kernels>> resources(
+        kernels({ &sum_baseline }, { { srs::isa::sse2, { &sum_sse2 } }, { srs::isa::avx2, { &sum_avx2 } }, { srs::isa::avx512, { &sum_avx512 } } }));
+
+    std::vector<int> const values(size, 1);
+    std::size_t const runs = 50'000'000 / (size + 8);
+    std::printf("%zu values per call, selected level %d\n", size, static_cast<int>(resources.get<kernels>().level()));
+
+    struct named
+    {
+        char const *name;
+        srs::isa level;
+        int (*sum)(int const *, std::size_t);
+    };
+    for (named const &variant : { named{ "  baseline", srs::isa::baseline, &sum_baseline }, named{ "  sse2", srs::isa::sse2, &sum_sse2 },
+                                  named{ "  avx2", srs::isa::avx2, &sum_avx2 }, named{ "  avx512", srs::isa::avx512, &sum_avx512 } })
+    {
+        if (variant.level <= srs::host_isa())
+        {
+            bench::run(variant.name, runs, [&](std::size_t) { bench::sink = bench::sink + variant.sum(values.data(), values.size()); });
+        }
+    }
+
+    bench::run("  kernel<Table> via get<Table>()", runs, [&](std::size_t) {
+        bench::sink = bench::sink + resources.get<sum_kernels>().sum(values.data(), values.size());
+    });
+    bench::run("  __builtin_cpu_supports per call", runs, [&](std::size_t) { bench::sink = bench::sink + sum_dispatch(values.data(), values.size()); });
+}
+}  // namespace
+
+int main()
+{
+    std::printf("host level %d\n", static_cast<int>(srs::host_isa()));
+    for (std::size_t const size : { 16, 256, 4096 })
+    {
+        compare(size);
+    }
+}
@@ -0,0 +1,143 @@
+#include "bench.hpp"
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+///
+/// @brief An object a bundle points to
+///
+struct payload
+{
+    std::array<long long, 32> values;
+};
+
+using bundle = srs::shared_resources<srs::type_list<std::array<long long, 32>, std::shared_ptr<payload>, int>>;
+
+///
+/// @brief The bundles, stored far apart from their payloads, and a random order to visit them in
+///
+struct working_set
+{
+    std::vector<bundle> bundles;
+    std::vector<std::size_t> order;
+};
+
+working_set make_working_set(std::size_t count)
+{
+    working_set set;
+    set.bundles.reserve(count);
+    std::vector<std::shared_ptr<payload>> payloads;
+    payloads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        payloads.push_back(std::make_shared<payload>());
+        payloads.back()->values.fill(static_cast<long long>(i));
+    }
+
+    std::mt19937_64 random(42);
+    std::shuffle(payloads.begin(), payloads.end(), random);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::array<long long, 32> own;
+        own.fill(1);
+        set.bundles.emplace_back(own, payloads[i], static_cast<int>(i));
+    }
+
+    set.order.resize(count);
+    std::iota(set.order.begin(), set.order.end(), std::size_t{ 0 });
+    std::shuffle(set.order.begin(), set.order.end(), random);
+    return set;
+}
+
+///
+/// @brief Reads every member of a bundle and the object its pointer refers to
+///
+long long touch(bundle const &resources)
+{
+    auto const &own     = resources.get<std::array<long long, 32>>();
+    auto const &pointee = resources.get<std::shared_ptr<payload>>()->values;
+    return own[0] + own[31] + pointee[0] + pointee[31] + resources.get<int>();
+}
+
+///
+/// @brief Streams through a buffer larger than the last-level cache to evict the working set
+///
+void evict(std::vector<long long> &buffer)
+{
+    for (std::size_t i = 0; i < buffer.size(); i += 8)
+    {
+        buffer[i] += 1;
+    }
+    bench::sink = bench::sink + buffer[buffer.size() / 2];
+}
+}  // namespace
+
+int main()
+{
+    constexpr std::size_t count    = std::size_t{ 1 } << 14;
+    constexpr std::size_t distance = 8;
+    constexpr std::size_t runs     = 20;
+
+    working_set const set = make_working_set(count);
+    std::vector<long long> buffer(std::size_t{ 64 } << 20 >> 3);
+    auto const cold = [&] { evict(buffer); };
+
+    std::printf("%zu bundles in random order after evicting the caches, time per sweep:\n", count);
+
+    double const plain = bench::run("  without prefetch", runs, cold, [&](std::size_t) {
+        long long total = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            total += touch(set.bundles[set.order[i]]);
+        }
+        bench::sink = bench::sink + total;
+    });
+
+    double const ahead = bench::run("  prefetch_all() 8 bundles ahead", runs, cold, [&](std::size_t) {
+        long long total = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i + distance < count)
+            {
+                set.bundles[set.order[i + distance]].prefetch_all();
+            }
+            total += touch(set.bundles[set.order[i]]);
+        }
+        bench::sink = bench::sink + total;
+    });
+
+    // Warming a few bundles right before a hot loop over them
+    constexpr std::size_t hot = 16;
+    double const warm_cold    = bench::run("  hot set, no warm-up", runs * 50, cold, [&](std::size_t) {
+        long long total = 0;
+        for (std::size_t i = 0; i < hot; ++i)
+        {
+            total += touch(set.bundles[set.order[i]]);
+        }
+        bench::sink = bench::sink + total;
+    });
+    double const warm_prefetched = bench::run("  hot set, prefetch_all() first", runs * 50, cold, [&](std::size_t) {
+        for (std::size_t i = 0; i < hot; ++i)
+        {
+            set.bundles[set.order[i]].prefetch_all();
+        }
+        long long total = 0;
+        for (std::size_t i = 0; i < hot; ++i)
+        {
+            total += touch(set.bundles[set.order[i]]);
+        }
+        bench::sink = bench::sink + total;
+    });
+
+    std::printf("streaming speedup %.2fx, hot set speedup %.2fx\n", plain / ahead, warm_cold / warm_prefetched);
+}
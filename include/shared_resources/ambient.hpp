@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file ambient.hpp
+///
+
+#ifndef SHARED_RESOURCES_AMBIENT_HPP
+#define SHARED_RESOURCES_AMBIENT_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+namespace internals
+{
+
+///
+/// @brief The resource of type T of the innermost scope of the current thread that provides T
+/// @tparam T The type of the resource
+///
+template <typename T>
+constinit inline thread_local T *ambient = nullptr;
+
+///
+/// @brief Installs the resources of a bundle as the ambient resources and restores the previous ones on destruction
+/// @tparam List The effective type_list of the bundle
+///
+template <type_list_concept List>
+class ambient_frame;
+
+template <typename... Types>
+class ambient_frame<type_list<Types...>>
+{
+public:
+    ///
+    /// @brief Installs the resources of a bundle
+    /// @tparam Bundle The type of the bundle
+    /// @param bundle The bundle
+    ///
+    template <typename Bundle>
+    explicit ambient_frame(Bundle &bundle) noexcept
+        : previous_(std::exchange(ambient<Types>, std::addressof(bundle.template get<Types>()))...)
+    {
+    }
+
+    ///
+    /// @brief Restores the previous resources
+    ///
+    ~ambient_frame()
+    {
+        restore(std::index_sequence_for<Types...>{});
+    }
+
+    ambient_frame(ambient_frame const &)            = delete;
+    ambient_frame &operator=(ambient_frame const &) = delete;
+
+private:
+    ///
+    /// @brief Restores the previous resources
+    /// @tparam Indices The indices of the types
+    ///
+    template <std::size_t... Indices>
+    void restore(std::index_sequence<Indices...>) noexcept
+    {
+        ((ambient<Types> = std::get<Indices>(previous_)), ...);
+    }
+
+    /// @brief The resources installed before this frame
+    std::tuple<Types *...> previous_;
+};
+
+}  // namespace internals
+
+///
+/// @brief Makes the resources of a bundle available through current<T>() on this thread for the lifetime of the scope
+/// @tparam Bundle The type of the bundle, which must not be const since current<T>() gives mutable access
+/// @note Scopes nest: a scope shadows the resources of the same types of enclosing scopes.
+///       Scopes must be destroyed in reverse order of construction, on the thread that constructed them.
+///
+template <bundle_concept Bundle>
+    requires(!std::is_const_v<Bundle>)
+class scope
+{
+public:
+    ///
+    /// @brief Installs the resources of a bundle
+    /// @param bundle The bundle, which must outlive the scope
+    ///
+    explicit scope(Bundle &bundle) noexcept
+        : frame_(bundle)
+    {
+    }
+
+    scope(scope const &)            = delete;
+    scope &operator=(scope const &) = delete;
+
+private:
+    /// @brief The installed resources
+    internals::ambient_frame<typename Bundle::resource_list> frame_;
+};
+
+///
+/// @brief Gets the resource of type T of the innermost scope that provides T
+/// @tparam T The type of the resource
+/// @return A pointer to the resource, or nullptr if no scope on this thread provides T
+///
+template <typename T>
+T *try_current() noexcept
+{
+    return internals::ambient<T>;
+}
+
+///
+/// @brief Gets the resource of type T of the innermost scope that provides T
+/// @tparam T The type of the resource
+/// @return A reference to the resource
+/// @note A scope on this thread must provide T
+///
+template <typename T>
+T &current() noexcept
+{
+    return *internals::ambient<T>;
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_AMBIENT_HPP
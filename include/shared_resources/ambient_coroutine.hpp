@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file ambient_coroutine.hpp
+///
+
+#ifndef SHARED_RESOURCES_AMBIENT_COROUTINE_HPP
+#define SHARED_RESOURCES_AMBIENT_COROUTINE_HPP
+
+#include <shared_resources/ambient.hpp>
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+namespace internals
+{
+
+///
+/// @brief Gets the awaiter of an awaitable, applying operator co_await if there is one
+/// @tparam Awaitable The type of the awaitable
+/// @param awaitable The awaitable
+/// @return The awaiter
+///
+template <typename Awaitable>
+decltype(auto) get_awaiter(Awaitable &&awaitable)
+{
+    if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); })
+    {
+        return std::forward<Awaitable>(awaitable).operator co_await();
+    }
+    else if constexpr (requires { operator co_await(std::forward<Awaitable>(awaitable)); })
+    {
+        return operator co_await(std::forward<Awaitable>(awaitable));
+    }
+    else
+    {
+        return std::forward<Awaitable>(awaitable);
+    }
+}
+
+///
+/// @brief The type to store an awaiter as: a reference to an lvalue, otherwise a value
+/// @tparam Awaiter The type returned by get_awaiter
+///
+template <typename Awaiter>
+using stored_awaiter_t = std::conditional_t<std::is_lvalue_reference_v<Awaiter>, Awaiter, std::remove_cvref_t<Awaiter>>;
+
+///
+/// @brief Wraps an awaiter to leave the ambient resources of a coroutine on suspension and enter them again on resumption
+/// @tparam Promise The type of the ambient_promise
+/// @tparam Awaiter The type of the wrapped awaiter, possibly an lvalue reference
+///
+template <typename Promise, typename Awaiter>
+class ambient_awaiter
+{
+public:
+    ///
+    /// @brief Constructs an ambient_awaiter
+    /// @tparam A The type of the awaiter to wrap
+    /// @param promise The promise of the coroutine
+    /// @param awaiter The awaiter to wrap
+    ///
+    template <typename A>
+    ambient_awaiter(Promise &promise, A &&awaiter)
+        : promise_(promise), awaiter_(std::forward<A>(awaiter))
+    {
+    }
+
+    bool await_ready()
+    {
+        return awaiter_.await_ready();
+    }
+
+    template <typename P>
+    auto await_suspend(std::coroutine_handle<P> handle)
+    {
+        using result_type = decltype(awaiter_.await_suspend(handle));
+
+        // The coroutine may be resumed on another thread as soon as the wrapped await_suspend runs
+        suspended_ = true;
+        promise_.leave_ambient();
+        try
+        {
+            if constexpr (std::same_as<result_type, bool>)
+            {
+                bool const suspend = awaiter_.await_suspend(handle);
+                if (!suspend)
+                {
+                    suspended_ = false;
+                    promise_.enter_ambient();
+                }
+                return suspend;
+            }
+            else
+            {
+                return awaiter_.await_suspend(handle);
+            }
+        }
+        catch (...)
+        {
+            suspended_ = false;
+            promise_.enter_ambient();
+            throw;
+        }
+    }
+
+    decltype(auto) await_resume()
+    {
+        if (suspended_)
+        {
+            promise_.enter_ambient();
+        }
+        return awaiter_.await_resume();
+    }
+
+private:
+    /// @brief The promise of the coroutine
+    Promise &promise_;
+
+    /// @brief The wrapped awaiter
+    Awaiter awaiter_;
+
+    /// @brief Whether the coroutine left its ambient resources in await_suspend
+    bool suspended_ = false;
+};
+
+///
+/// @brief Wraps the awaiter of a final suspend point to leave the ambient resources of a coroutine
+/// @tparam Promise The type of the ambient_promise
+/// @tparam Awaiter The type of the wrapped awaiter, possibly an lvalue reference
+///
+template <typename Promise, typename Awaiter>
+class ambient_final_awaiter
+{
+public:
+    ///
+    /// @brief Constructs an ambient_final_awaiter
+    /// @tparam A The type of the awaiter to wrap
+    /// @param promise The promise of the coroutine
+    /// @param awaiter The awaiter to wrap
+    ///
+    template <typename A>
+    ambient_final_awaiter(Promise &promise, A &&awaiter) noexcept
+        : promise_(promise), awaiter_(std::forward<A>(awaiter))
+    {
+    }
+
+    bool await_ready() noexcept
+    {
+        promise_.leave_ambient();
+        return awaiter_.await_ready();
+    }
+
+    template <typename P>
+    auto await_suspend(std::coroutine_handle<P> handle) noexcept
+    {
+        return awaiter_.await_suspend(handle);
+    }
+
+    void await_resume() noexcept
+    {
+    }
+
+private:
+    /// @brief The promise of the coroutine
+    Promise &promise_;
+
+    /// @brief The wrapped awaiter
+    Awaiter awaiter_;
+};
+
+}  // namespace internals
+
+///
+/// @brief Promise mixin that makes the ambient resources of the listed types follow a coroutine across suspensions
+/// @tparam List A type_list of the resource types to follow
+/// @note The coroutine captures the ambient resources of the thread that creates it, and scopes opened inside the
+///       coroutine stay in effect across suspensions. Whenever the coroutine suspends, the resuming thread gets its
+///       own ambient resources back. The state lives in the promise, so no suspension allocates.
+///
+///       A promise type inherits from ambient_promise, wraps its initial and final suspend points and the awaiter of
+///       any yield_value, since co_yield does not go through await_transform, and leaves the ambient resources of the
+///       coroutine when the body throws:
+///       @code
+///       struct promise_type : srs::ambient_promise<srs::type_list<Logger>>
+///       {
+///           auto initial_suspend() { return ambient_initial_suspend(std::suspend_always{}); }
+///           auto final_suspend() noexcept { return ambient_final_suspend(std::suspend_always{}); }
+///           auto yield_value(int value) { current = value; return ambient_yield_value(std::suspend_always{}); }
+///           void unhandled_exception() { ambient_unhandled_exception(); throw; }
+///           // ...
+///       };
+///       @endcode
+///       A promise that defines its own await_transform passes its result through ambient_promise::await_transform.
+///
+template <type_list_concept List>
+class ambient_promise;
+
+template <typename... Types>
+class ambient_promise<type_list<Types...>>
+{
+public:
+    ///
+    /// @brief Wraps the awaitable of a co_await expression of the coroutine
+    /// @tparam Awaitable The type of the awaitable
+    /// @param awaitable The awaitable
+    /// @return The wrapping awaiter
+    ///
+    template <typename Awaitable>
+    auto await_transform(Awaitable &&awaitable)
+    {
+        using awaiter_type = internals::stored_awaiter_t<decltype(internals::get_awaiter(std::forward<Awaitable>(awaitable)))>;
+        return internals::ambient_awaiter<ambient_promise, awaiter_type>(*this, internals::get_awaiter(std::forward<Awaitable>(awaitable)));
+    }
+
+    ///
+    /// @brief Wraps the awaitable of the initial suspend point
+    /// @tparam Awaitable The type of the awaitable
+    /// @param awaitable The awaitable returned by initial_suspend
+    /// @return The wrapping awaiter
+    ///
+    template <typename Awaitable>
+    auto ambient_initial_suspend(Awaitable &&awaitable)
+    {
+        return await_transform(std::forward<Awaitable>(awaitable));
+    }
+
+    ///
+    /// @brief Wraps the awaitable returned by yield_value for a co_yield expression
+    /// @tparam Awaitable The type of the awaitable
+    /// @param awaitable The awaitable yield_value returns
+    /// @return The wrapping awaiter
+    ///
+    template <typename Awaitable>
+    auto ambient_yield_value(Awaitable &&awaitable)
+    {
+        return await_transform(std::forward<Awaitable>(awaitable));
+    }
+
+    ///
+    /// @brief Wraps the awaitable of the final suspend point
+    /// @tparam Awaitable The type of the awaitable
+    /// @param awaitable The awaitable returned by final_suspend
+    /// @return The wrapping awaiter
+    ///
+    template <typename Awaitable>
+    auto ambient_final_suspend(Awaitable &&awaitable) noexcept
+    {
+        using awaiter_type = internals::stored_awaiter_t<decltype(internals::get_awaiter(std::forward<Awaitable>(awaitable)))>;
+        return internals::ambient_final_awaiter<ambient_promise, awaiter_type>(*this, internals::get_awaiter(std::forward<Awaitable>(awaitable)));
+    }
+
+    ///
+    /// @brief Restores the ambient resources of the thread when the body of the coroutine throws
+    /// @note Called from unhandled_exception, whether it rethrows or stores the exception; the final suspend point
+    ///       does not restore them again
+    ///
+    void ambient_unhandled_exception() noexcept
+    {
+        leave_ambient();
+    }
+
+    ///
+    /// @brief Restores the ambient resources of the thread and rethrows the exception of the body of the coroutine
+    ///
+    void unhandled_exception()
+    {
+        ambient_unhandled_exception();
+        throw;
+    }
+
+private:
+    ///
+    /// @brief Saves the ambient resources of the coroutine and restores those of the thread, if the coroutine runs
+    ///
+    void leave_ambient() noexcept
+    {
+        if (inside_)
+        {
+            leave(std::index_sequence_for<Types...>{});
+            inside_ = false;
+        }
+    }
+
+    ///
+    /// @brief Saves the ambient resources of the thread and restores those of the coroutine, if it is suspended
+    ///
+    void enter_ambient() noexcept
+    {
+        if (!inside_)
+        {
+            enter(std::index_sequence_for<Types...>{});
+            inside_ = true;
+        }
+    }
+
+    template <std::size_t... Indices>
+    void leave(std::index_sequence<Indices...>) noexcept
+    {
+        ((std::get<Indices>(inner_) = std::exchange(internals::ambient<Types>, std::get<Indices>(outer_))), ...);
+    }
+
+    template <std::size_t... Indices>
+    void enter(std::index_sequence<Indices...>) noexcept
+    {
+        ((std::get<Indices>(outer_) = std::exchange(internals::ambient<Types>, std::get<Indices>(inner_))), ...);
+    }
+
+    /// @brief The ambient resources of the coroutine while it is suspended
+    std::tuple<Types *...> inner_{ internals::ambient<Types>... };
+
+    /// @brief The ambient resources of the thread running the coroutine, while it runs
+    std::tuple<Types *...> outer_ = inner_;
+
+    /// @brief Whether the ambient resources of the coroutine are installed on the thread
+    bool inside_ = true;
+
+    template <typename, typename>
+    friend class internals::ambient_awaiter;
+
+    template <typename, typename>
+    friend class internals::ambient_final_awaiter;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_AMBIENT_COROUTINE_HPP
@@ -0,0 +1,485 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file any_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_ANY_RESOURCES_HPP
+#define SHARED_RESOURCES_ANY_RESOURCES_HPP
+
+#include <shared_resources/erased.hpp>
+#include <shared_resources/shared_resources.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+
+/// @brief The maximum size of a resource that any_resources stores inline in its arena
+inline constexpr std::size_t any_resources_inline_size = 64;
+
+namespace internals
+{
+
+/// @brief The operations of a slot holding T; small resources live in the slot, others on the heap
+template <typename T>
+inline constexpr erased_ops any_ops_for = erased_ops_for<T, any_resources_inline_size>;
+
+}  // namespace internals
+
+///
+/// @brief Provides shared resources whose types are decided at runtime
+/// @note Resources are stored in one contiguous arena, small ones inline, and indexed by a sorted table of type_ids.
+///       Inserting a resource may move the others, which invalidates references to them.
+///
+class any_resources
+{
+public:
+    ///
+    /// @brief Default constructor
+    ///
+    any_resources() noexcept = default;
+
+    ///
+    /// @brief Constructs any_resources with a copy of every resource of a bundle
+    /// @tparam Bundle The type of the bundle
+    /// @param bundle The shared_resources or shared_references to copy from
+    ///
+    template <shared_concept Bundle>
+    explicit any_resources(Bundle const &bundle)
+    {
+        insert_all(bundle, typename Bundle::resource_list{});
+    }
+
+    ///
+    /// @brief Copy constructor
+    /// @param other The other any_resources to copy from
+    ///
+    any_resources(any_resources const &other)
+    {
+        reserve(other.packed_size(), other.entries_.size());
+        try
+        {
+            for (auto const &entry : other.entries_)
+            {
+                std::size_t const offset = allocate(*entry.ops);
+                entry.ops->copy(arena_.get() + offset, other.arena_.get() + entry.offset);
+                entries_.push_back({ entry.id, offset, entry.ops });
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    ///
+    /// @brief Move constructor
+    /// @param other The other any_resources to move from
+    ///
+    any_resources(any_resources &&other) noexcept
+        : arena_(std::move(other.arena_)), capacity_(std::exchange(other.capacity_, 0)), used_(std::exchange(other.used_, 0)), entries_(std::move(other.entries_))
+    {
+        other.entries_.clear();
+    }
+
+    ///
+    /// @brief Copy assignment operator
+    /// @param other The other any_resources to copy from
+    /// @return A reference to this any_resources
+    ///
+    any_resources &operator=(any_resources const &other)
+    {
+        if (this != &other)
+        {
+            *this = any_resources(other);
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Move assignment operator
+    /// @param other The other any_resources to move from
+    /// @return A reference to this any_resources
+    ///
+    any_resources &operator=(any_resources &&other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            arena_    = std::move(other.arena_);
+            capacity_ = std::exchange(other.capacity_, 0);
+            used_     = std::exchange(other.used_, 0);
+            entries_  = std::move(other.entries_);
+            other.entries_.clear();
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Destructor
+    ///
+    ~any_resources()
+    {
+        clear();
+    }
+
+    ///
+    /// @brief Constructs a resource of type T, replacing any resource of the same type
+    /// @tparam T The type of the resource
+    /// @tparam Args The types of the constructor arguments
+    /// @param args The constructor arguments, which must not refer to resources of this any_resources
+    /// @return A reference to the new resource
+    ///
+    template <typename T, typename... Args>
+        requires std::copy_constructible<T> && std::constructible_from<T, Args...>
+    T &emplace(Args &&...args)
+    {
+        constexpr internals::erased_ops const &ops = internals::any_ops_for<T>;
+        reserve(ops.size + ops.align, entries_.size() + 1);
+
+        std::size_t const offset = allocate(ops);
+        void *const slot         = arena_.get() + offset;
+        internals::erased_construct<T, any_resources_inline_size>(slot, std::forward<Args>(args)...);
+
+        auto const it = lower_bound(entries_, type_id_of<T>);
+        if (it != entries_.end() && it->id == type_id_of<T>)
+        {
+            // The old slot is left as a hole until the arena is reallocated
+            it->ops->destroy(arena_.get() + it->offset);
+            it->offset = offset;
+        }
+        else
+        {
+            entries_.insert(it, { type_id_of<T>, offset, &ops });
+        }
+        return *static_cast<T *>(ops.get(slot));
+    }
+
+    ///
+    /// @brief Stores a copy of a resource, replacing any resource of the same type
+    /// @tparam T The type of the resource
+    /// @param value The resource to store
+    /// @return A reference to the stored resource
+    ///
+    template <typename T>
+    std::remove_cvref_t<T> &insert(T &&value)
+    {
+        return emplace<std::remove_cvref_t<T>>(std::forward<T>(value));
+    }
+
+    ///
+    /// @brief Destroys the resource of type T, if any
+    /// @tparam T The type of the resource
+    /// @return true if a resource was destroyed
+    ///
+    template <typename T>
+    bool erase() noexcept
+    {
+        auto const it = lower_bound(entries_, type_id_of<T>);
+        if (it == entries_.end() || it->id != type_id_of<T>)
+        {
+            return false;
+        }
+        it->ops->destroy(arena_.get() + it->offset);
+        entries_.erase(it);
+        return true;
+    }
+
+    ///
+    /// @brief Finds a resource by its runtime type_id
+    /// @param id The type_id of the resource
+    /// @return The address of the resource, or nullptr if there is no resource with the type_id
+    ///
+    void *find(type_id id) noexcept
+    {
+        auto const it = lower_bound(entries_, id);
+        return it != entries_.end() && it->id == id ? it->ops->get(arena_.get() + it->offset) : nullptr;
+    }
+
+    ///
+    /// @brief Finds a resource by its runtime type_id
+    /// @param id The type_id of the resource
+    /// @return The address of the resource, or nullptr if there is no resource with the type_id
+    ///
+    void const *find(type_id id) const noexcept
+    {
+        auto const it = lower_bound(entries_, id);
+        return it != entries_.end() && it->id == id ? it->ops->get(arena_.get() + it->offset) : nullptr;
+    }
+
+    ///
+    /// @brief Finds the resource of type T
+    /// @tparam T The type of the resource
+    /// @return A pointer to the resource, or nullptr if there is none
+    ///
+    template <typename T>
+    T *try_get() noexcept
+    {
+        return static_cast<T *>(find(type_id_of<T>));
+    }
+
+    ///
+    /// @brief Finds the resource of type T
+    /// @tparam T The type of the resource
+    /// @return A pointer to the resource, or nullptr if there is none
+    ///
+    template <typename T>
+    T const *try_get() const noexcept
+    {
+        return static_cast<T const *>(find(type_id_of<T>));
+    }
+
+    ///
+    /// @brief Gets a reference to the resource of type T
+    /// @tparam T The type of the resource
+    /// @return A reference to the resource
+    /// @throw std::out_of_range If there is no resource of type T
+    ///
+    template <typename T>
+    T &get()
+    {
+        return *checked(try_get<T>());
+    }
+
+    ///
+    /// @brief Gets a const reference to the resource of type T
+    /// @tparam T The type of the resource
+    /// @return A const reference to the resource
+    /// @throw std::out_of_range If there is no resource of type T
+    ///
+    template <typename T>
+    T const &get() const
+    {
+        return *checked(try_get<T>());
+    }
+
+    ///
+    /// @brief Checks if there is a resource of type T
+    /// @tparam T The type of the resource
+    /// @return true if there is a resource of type T
+    ///
+    template <typename T>
+    bool contains() const noexcept
+    {
+        return find(type_id_of<T>) != nullptr;
+    }
+
+    ///
+    /// @brief Gets the number of resources
+    /// @return The number of resources
+    ///
+    std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    ///
+    /// @brief Creates a shared_resources with copies of the resources
+    /// @tparam Bundle The type of the shared_resources
+    /// @return The shared_resources
+    /// @throw std::out_of_range If a type of Bundle is missing
+    ///
+    template <shared_resources_concept Bundle>
+    Bundle as() const
+    {
+        return make_bundle<Bundle>(*this, typename Bundle::resource_list{});
+    }
+
+    ///
+    /// @brief Creates a shared_references to the resources
+    /// @tparam Bundle The type of the shared_references
+    /// @return The shared_references
+    /// @throw std::out_of_range If a type of Bundle is missing
+    /// @note The references are invalidated when a resource is inserted into or erased from this any_resources
+    ///
+    template <shared_references_concept Bundle>
+    Bundle as()
+    {
+        return make_bundle<Bundle>(*this, typename Bundle::resource_list{});
+    }
+
+private:
+    /// @brief An entry of the type index
+    struct entry
+    {
+        /// @brief The type_id of the resource
+        type_id id;
+
+        /// @brief The offset of the slot in the arena
+        std::size_t offset;
+
+        /// @brief The operations of the slot
+        internals::erased_ops const *ops;
+    };
+
+    ///
+    /// @brief Copies every resource of a bundle
+    /// @tparam Bundle The type of the bundle
+    /// @tparam Types The effective types of the bundle
+    /// @param bundle The bundle to copy from
+    ///
+    template <typename Bundle, typename... Types>
+    void insert_all(Bundle const &bundle, type_list<Types...>)
+    {
+        (emplace<Types>(bundle.template get<Types>()), ...);
+    }
+
+    ///
+    /// @brief Creates a bundle from the resources of self
+    /// @tparam Bundle The type of the bundle
+    /// @tparam Self The type of self, possibly const
+    /// @tparam Types The effective types of the bundle
+    /// @param self The any_resources to create the bundle from
+    /// @return The bundle
+    ///
+    template <typename Bundle, typename Self, typename... Types>
+    static Bundle make_bundle(Self &self, type_list<Types...>)
+    {
+        if constexpr (shared_resources_concept<Bundle>)
+        {
+            return Bundle(in_order, self.template get<Types>()...);
+        }
+        else
+        {
+            return Bundle(self.template get<Types>()...);
+        }
+    }
+
+    ///
+    /// @brief Checks that a pointer to a resource is not null
+    /// @param ptr The pointer to check
+    /// @return ptr
+    /// @throw std::out_of_range If ptr is null
+    ///
+    template <typename T>
+    static T *checked(T *ptr)
+    {
+        if (ptr == nullptr)
+        {
+            throw std::out_of_range("srs::any_resources: no resource of the requested type");
+        }
+        return ptr;
+    }
+
+    ///
+    /// @brief Finds the first entry whose type_id is not less than id
+    /// @tparam Entries The type of the type index, possibly const
+    /// @param entries The type index
+    /// @param id The type_id to search for
+    /// @return An iterator to the entry
+    ///
+    template <typename Entries>
+    static auto lower_bound(Entries &entries, type_id id) noexcept -> decltype(entries.begin())
+    {
+        return std::lower_bound(entries.begin(), entries.end(), id, [](entry const &e, type_id value) { return e.id < value; });
+    }
+
+    ///
+    /// @brief Gets the number of arena bytes the resources take when packed in type index order
+    /// @return The number of bytes, including alignment padding
+    ///
+    std::size_t packed_size() const noexcept
+    {
+        std::size_t size = 0;
+        for (auto const &entry : entries_)
+        {
+            size = (size + entry.ops->align - 1) / entry.ops->align * entry.ops->align + entry.ops->size;
+        }
+        return size;
+    }
+
+    ///
+    /// @brief Ensures space for the given number of additional bytes and entries
+    /// @param bytes The number of arena bytes needed past the used ones
+    /// @param entries The number of entries needed
+    /// @note Growing the arena relocates every resource and drops the holes left by replaced resources. The packed
+    ///       layout can need more padding than the current one, so the new size is computed from it.
+    ///
+    void reserve(std::size_t bytes, std::size_t entries)
+    {
+        entries_.reserve(entries);
+        if (used_ + bytes <= capacity_)
+        {
+            return;
+        }
+
+        std::size_t const capacity = std::max(packed_size() + bytes, capacity_ * 2);
+        std::unique_ptr<std::max_align_t[]> arena(new std::max_align_t[(capacity + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]);
+        std::size_t used = 0;
+        for (auto &entry : entries_)
+        {
+            used = (used + entry.ops->align - 1) / entry.ops->align * entry.ops->align;
+            entry.ops->relocate(reinterpret_cast<std::byte *>(arena.get()) + used, arena_.get() + entry.offset);
+            entry.offset = used;
+            used += entry.ops->size;
+        }
+        arena_.reset(reinterpret_cast<std::byte *>(arena.release()));
+        capacity_ = capacity;
+        used_     = used;
+    }
+
+    ///
+    /// @brief Allocates an aligned slot at the end of the arena
+    /// @param ops The operations of the slot
+    /// @return The offset of the slot
+    /// @note The arena must have enough space
+    ///
+    std::size_t allocate(internals::erased_ops const &ops) noexcept
+    {
+        std::size_t const offset = (used_ + ops.align - 1) / ops.align * ops.align;
+        used_                    = offset + ops.size;
+        return offset;
+    }
+
+    ///
+    /// @brief Destroys every resource
+    ///
+    void clear() noexcept
+    {
+        for (auto const &entry : entries_)
+        {
+            entry.ops->destroy(arena_.get() + entry.offset);
+        }
+        entries_.clear();
+        used_ = 0;
+    }
+
+    /// @brief Deletes an arena allocated as an array of std::max_align_t
+    struct arena_deleter
+    {
+        void operator()(std::byte *arena) const noexcept
+        {
+            delete[] reinterpret_cast<std::max_align_t *>(arena);
+        }
+    };
+
+    /// @brief The arena holding the slots
+    std::unique_ptr<std::byte, arena_deleter> arena_;
+
+    /// @brief The size of the arena in bytes
+    std::size_t capacity_ = 0;
+
+    /// @brief The number of bytes used in the arena
+    std::size_t used_ = 0;
+
+    /// @brief The type index, sorted by type_id
+    std::vector<entry> entries_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_ANY_RESOURCES_HPP
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file batch.hpp
+///
+
+#ifndef SHARED_RESOURCES_BATCH_HPP
+#define SHARED_RESOURCES_BATCH_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/for_each.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace srs
+{
+
+/// @brief The minimum number of bundles each thread of par_make_batch constructs
+inline constexpr std::size_t batch_grain = 1024;
+
+namespace internals
+{
+
+///
+/// @brief Checks that Columns provide exactly one column per effective type of Bundle
+/// @tparam Bundle The shared_resources type to construct
+/// @tparam Columns The types of the column ranges
+///
+template <typename Bundle, typename... Columns>
+concept batch_columns_concept = shared_resources_concept<Bundle>
+                                && ((std::ranges::random_access_range<Columns const> && std::ranges::sized_range<Columns const>) && ...)
+                                && sizeof...(Columns) == type_list_size<typename Bundle::resource_list>::value
+                                && contains_all_concept<typename Bundle::resource_list, type_list<std::ranges::range_value_t<Columns const>...>>;
+
+///
+/// @brief Returns the common size of the columns
+/// @tparam Columns The types of the column ranges
+/// @param columns The column ranges
+/// @return The number of rows
+/// @throw std::invalid_argument If the columns differ in size
+///
+template <typename... Columns>
+std::size_t batch_size(Columns const &...columns)
+{
+    std::size_t const sizes[] = { static_cast<std::size_t>(std::ranges::size(columns))..., 0 };
+    if (!std::all_of(sizes, sizes + sizeof...(Columns), [&](std::size_t size) { return size == sizes[0]; }))
+    {
+        throw std::invalid_argument("srs::make_batch: columns differ in size");
+    }
+    return sizes[0];
+}
+
+///
+/// @brief Constructs bundles from rows of columns
+/// @tparam Bundle The shared_resources type to construct
+/// @tparam Columns The types of the column ranges
+///
+template <typename Bundle, typename... Columns>
+class batch_rows
+{
+public:
+    ///
+    /// @brief Constructs batch_rows from column ranges
+    /// @param columns The column ranges
+    ///
+    explicit batch_rows(Columns const &...columns)
+        : iterators_(std::ranges::begin(columns)...)
+    {
+    }
+
+    ///
+    /// @brief Constructs the bundle of a row
+    /// @param row The index of the row
+    /// @return The bundle of the row
+    ///
+    Bundle operator()(std::size_t row) const
+    {
+        return make(row, typename Bundle::resource_list{});
+    }
+
+private:
+    /// @brief The value types of the columns
+    using column_types = type_list<std::ranges::range_value_t<Columns const>...>;
+
+    ///
+    /// @brief Constructs the bundle of a row with the columns in effective type list order
+    /// @tparam Types The effective types of Bundle
+    /// @param row The index of the row
+    /// @return The bundle of the row
+    ///
+    template <typename... Types>
+    Bundle make(std::size_t row, type_list<Types...>) const
+    {
+        return Bundle(in_order, std::get<index_of<Types, column_types>::value>(iterators_)[row]...);
+    }
+
+    /// @brief The begin iterators of the columns
+    std::tuple<std::ranges::iterator_t<Columns const>...> iterators_;
+};
+
+}  // namespace internals
+
+///
+/// @brief Constructs one bundle per row of parallel column ranges
+/// @tparam Bundle The shared_resources type to construct
+/// @tparam Columns The types of the column ranges, one per effective type of Bundle in any order
+/// @param columns The column ranges, all of the same size
+/// @return The constructed bundles
+/// @throw std::invalid_argument If the columns differ in size
+///
+template <typename Bundle, typename... Columns>
+    requires internals::batch_columns_concept<Bundle, Columns...>
+std::vector<Bundle> make_batch(Columns const &...columns)
+{
+    std::size_t const size = internals::batch_size(columns...);
+    internals::batch_rows<Bundle, Columns...> const rows(columns...);
+
+    std::vector<Bundle> result;
+    result.reserve(size);
+    for (std::size_t row = 0; row < size; ++row)
+    {
+        result.push_back(rows(row));
+    }
+    return result;
+}
+
+///
+/// @brief Constructs one bundle per row of parallel column ranges in uninitialized storage, using several threads
+/// @tparam Bundle The shared_resources type to construct
+/// @tparam Columns The types of the column ranges, one per effective type of Bundle in any order
+/// @param out Uninitialized storage for as many bundles as the columns have rows
+/// @param columns The column ranges, all of the same size
+/// @note Each thread constructs at least batch_grain bundles in place; small batches run on the calling thread. The
+///       caller destroys the bundles, e.g. with std::destroy_n. If a construction throws, every bundle already
+///       constructed is destroyed before the exception is rethrown.
+/// @throw std::invalid_argument If the columns differ in size
+/// @throw Any exception thrown by reading a column
+///
+template <typename Bundle, typename... Columns>
+    requires internals::batch_columns_concept<Bundle, Columns...>
+void par_make_batch(Bundle *out, Columns const &...columns)
+{
+    std::size_t const size = internals::batch_size(columns...);
+    internals::batch_rows<Bundle, Columns...> const rows(columns...);
+
+    std::size_t const threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    std::size_t const groups  = std::clamp<std::size_t>(size / batch_grain, 1, threads);
+    std::size_t const chunk   = (size + groups - 1) / groups;
+    std::vector<char> built(groups, 0);
+    auto run_group = [&](std::size_t group) {
+        std::size_t const first = std::min(size, group * chunk);
+        std::size_t const last  = std::min(size, first + chunk);
+        std::size_t row         = first;
+        try
+        {
+            for (; row < last; ++row)
+            {
+                // The prvalue returned by rows initializes the storage directly
+                ::new (static_cast<void *>(out + row)) Bundle(rows(row));
+            }
+        }
+        catch (...)
+        {
+            std::destroy(out + first, out + row);
+            throw;
+        }
+        built[group] = 1;
+    };
+
+    try
+    {
+        internals::parallel_invoke(groups, run_group);
+    }
+    catch (...)
+    {
+        for (std::size_t group = 0; group < groups; ++group)
+        {
+            if (built[group] != 0)
+            {
+                std::destroy(out + std::min(size, group * chunk), out + std::min(size, (group + 1) * chunk));
+            }
+        }
+        throw;
+    }
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_BATCH_HPP
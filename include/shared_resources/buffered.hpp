@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file buffered.hpp
+///
+
+#ifndef SHARED_RESOURCES_BUFFERED_HPP
+#define SHARED_RESOURCES_BUFFERED_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace srs
+{
+
+///
+/// @brief A resource slot with a front buffer for readers and a back buffer the producer rebuilds
+/// @tparam T The type of the resource
+/// @note publish() swaps the buffers with one atomic store, so readers always see a complete version. Since the producer
+///       writes into the previous front buffer after publishing, readers must be done with a front buffer before the
+///       producer starts the next tick; use triple_buffered when stages are not synchronized that way.
+///
+template <typename T>
+class double_buffered
+{
+public:
+    /// @brief The type of the resource
+    using value_type = T;
+
+    ///
+    /// @brief Constructs both buffers as copies of an initial value
+    /// @param initial The initial value
+    ///
+    explicit double_buffered(T const &initial)
+        : buffers_{ { initial }, { initial } }
+    {
+    }
+
+    ///
+    /// @brief Copy constructor; must not run concurrently with publish()
+    /// @param other The slot to copy
+    ///
+    double_buffered(double_buffered const &other)
+        : buffers_{ other.buffers_[0], other.buffers_[1] }, front_(other.front_.load())
+    {
+    }
+
+    double_buffered &operator=(double_buffered const &) = delete;
+
+    ///
+    /// @brief Gets the buffer the producer writes
+    /// @return A reference to the back buffer
+    ///
+    T &back() noexcept
+    {
+        return buffers_[front_.load(std::memory_order_relaxed) ^ 1].value;
+    }
+
+    ///
+    /// @brief Gets the last published version
+    /// @return A const reference to the front buffer
+    ///
+    T const &front() const noexcept
+    {
+        return buffers_[front_.load(std::memory_order_acquire)].value;
+    }
+
+    ///
+    /// @brief Gets the last published version, like front()
+    /// @return A const reference to the front buffer
+    ///
+    T const &last_published() const noexcept
+    {
+        return front();
+    }
+
+    ///
+    /// @brief Makes the back buffer the front buffer; called by the producer
+    ///
+    void publish() noexcept
+    {
+        front_.store(front_.load(std::memory_order_relaxed) ^ 1, std::memory_order_release);
+    }
+
+private:
+    /// @brief A buffer on its own cache lines
+    struct alignas(64) buffer
+    {
+        T value;
+    };
+
+    /// @brief The buffers
+    buffer buffers_[2];
+
+    /// @brief The index of the front buffer
+    std::atomic<unsigned> front_{ 0 };
+};
+
+///
+/// @brief A resource slot for one producer and one consumer that never wait for each other
+/// @tparam T The type of the resource
+/// @note The producer writes the back buffer and publishes it into the middle; the consumer takes the middle buffer
+///       when a newer version is there. Each side owns its buffer until it swaps it with one atomic exchange, so
+///       neither side locks or allocates and the consumer keeps a complete version for as long as it needs.
+///
+template <typename T>
+class triple_buffered
+{
+public:
+    /// @brief The type of the resource
+    using value_type = T;
+
+    ///
+    /// @brief Constructs the three buffers as copies of an initial value
+    /// @param initial The initial value
+    ///
+    explicit triple_buffered(T const &initial)
+        : buffers_{ { initial }, { initial }, { initial } }
+    {
+    }
+
+    ///
+    /// @brief Copy constructor; must not run concurrently with publish() or front()
+    /// @param other The slot to copy
+    ///
+    triple_buffered(triple_buffered const &other)
+        : buffers_{ other.buffers_[0], other.buffers_[1], other.buffers_[2] }, middle_(other.middle_.load()), front_(other.front_), back_(other.back_)
+    {
+    }
+
+    triple_buffered &operator=(triple_buffered const &) = delete;
+
+    ///
+    /// @brief Gets the buffer the producer writes
+    /// @return A reference to the back buffer
+    ///
+    T &back() noexcept
+    {
+        return buffers_[back_].value;
+    }
+
+    ///
+    /// @brief Hands the back buffer to the consumer; called by the producer
+    ///
+    void publish() noexcept
+    {
+        back_ = middle_.exchange(back_ | fresh, std::memory_order_acq_rel) & index_mask;
+    }
+
+    ///
+    /// @brief Gets the latest published version; called by the single consumer
+    /// @return A const reference to the consumer's buffer, valid until the next call
+    /// @note Non-const since taking a newer version swaps which buffer the consumer owns; use last_published() to
+    ///       read through a const slot
+    ///
+    T const &front() noexcept
+    {
+        if ((middle_.load(std::memory_order_relaxed) & fresh) != 0)
+        {
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & index_mask;
+        }
+        return buffers_[front_].value;
+    }
+
+    ///
+    /// @brief Gets the version the consumer took last, without taking a newer one
+    /// @return A const reference to the consumer's buffer
+    /// @note Must not run concurrently with front()
+    ///
+    T const &last_published() const noexcept
+    {
+        return buffers_[front_].value;
+    }
+
+    ///
+    /// @brief Checks if a version newer than the consumer's is published
+    /// @return true if the next front() returns a newer version
+    ///
+    bool fresh_available() const noexcept
+    {
+        return (middle_.load(std::memory_order_relaxed) & fresh) != 0;
+    }
+
+private:
+    /// @brief The bits of middle_ holding the index of the middle buffer
+    static constexpr unsigned index_mask = 0b011;
+
+    /// @brief The bit of middle_ set when the middle buffer was published after the consumer last took one
+    static constexpr unsigned fresh = 0b100;
+
+    /// @brief A buffer on its own cache lines
+    struct alignas(64) buffer
+    {
+        T value;
+    };
+
+    /// @brief The buffers
+    buffer buffers_[3];
+
+    /// @brief The index of the middle buffer and the fresh bit
+    std::atomic<unsigned> middle_{ 1 };
+
+    /// @brief The index of the buffer owned by the consumer
+    unsigned front_ = 0;
+
+    /// @brief The index of the buffer owned by the producer
+    unsigned back_ = 2;
+};
+
+namespace internals
+{
+
+///
+/// @brief Finds the buffered slot of type T in a type_list
+/// @tparam T The type of the resource
+/// @tparam List The type_list to search
+///
+template <typename T, type_list_concept List>
+struct buffered_slot
+{
+    static_assert(!(contains<double_buffered<T>, List>::value && contains<triple_buffered<T>, List>::value),
+                  "T is both double- and triple-buffered");
+
+    using type = std::conditional_t<contains<triple_buffered<T>, List>::value, triple_buffered<T>, double_buffered<T>>;
+};
+
+///
+/// @brief Checks if a bundle holds a buffered slot of type T
+///
+template <typename T, typename Bundle>
+concept buffered_concept = bundle_concept<Bundle>
+                        && (contains<double_buffered<T>, typename Bundle::resource_list>::value
+                            || contains<triple_buffered<T>, typename Bundle::resource_list>::value);
+
+}  // namespace internals
+
+///
+/// @brief Gets the back buffer of the buffered slot of type T in a bundle
+/// @tparam T The type of the resource
+/// @tparam Bundle The type of the bundle
+/// @param bundle The bundle
+/// @return A reference to the buffer the producer writes
+///
+template <typename T, typename Bundle>
+    requires internals::buffered_concept<T, Bundle>
+T &back(Bundle &bundle) noexcept
+{
+    return bundle.template get<typename internals::buffered_slot<T, typename Bundle::resource_list>::type>().back();
+}
+
+///
+/// @brief Gets the latest published version of the buffered slot of type T in a bundle
+/// @tparam T The type of the resource
+/// @tparam Bundle The type of the bundle
+/// @param bundle The bundle
+/// @return A const reference to the front buffer
+/// @note A triple_buffered slot has a single consumer: front() takes the newer version for its caller, so only one
+///       thread may call it, through a non-const bundle. Use last_published<T>() to read through a const bundle.
+///
+template <typename T, typename Bundle>
+    requires internals::buffered_concept<T, Bundle>
+T const &front(Bundle &bundle) noexcept
+{
+    return bundle.template get<typename internals::buffered_slot<T, typename Bundle::resource_list>::type>().front();
+}
+
+///
+/// @brief Gets the version of the buffered slot of type T in a bundle without taking a newer one
+/// @tparam T The type of the resource
+/// @tparam Bundle The type of the bundle
+/// @param bundle The bundle
+/// @return A const reference to the front buffer of a double_buffered, or the consumer's buffer of a triple_buffered
+///
+template <typename T, typename Bundle>
+    requires internals::buffered_concept<T, Bundle>
+T const &last_published(Bundle const &bundle) noexcept
+{
+    return bundle.template get<typename internals::buffered_slot<T, typename Bundle::resource_list>::type>().last_published();
+}
+
+///
+/// @brief Publishes the back buffer of the buffered slot of type T in a bundle
+/// @tparam T The type of the resource
+/// @tparam Bundle The type of the bundle
+/// @param bundle The bundle
+///
+template <typename T, typename Bundle>
+    requires internals::buffered_concept<T, Bundle>
+void publish(Bundle &bundle) noexcept
+{
+    bundle.template get<typename internals::buffered_slot<T, typename Bundle::resource_list>::type>().publish();
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_BUFFERED_HPP
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file builder.hpp
+///
+
+#ifndef SHARED_RESOURCES_BUILDER_HPP
+#define SHARED_RESOURCES_BUILDER_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace srs
+{
+namespace internals
+{
+
+///
+/// @brief The resources staged by a builder, one optional per type
+/// @tparam List The effective type_list of the bundle
+///
+template <type_list_concept List>
+struct builder_staging;
+
+template <typename... Types>
+struct builder_staging<type_list<Types...>>
+{
+    std::tuple<std::optional<Types>...> values;
+};
+
+}  // namespace internals
+
+///
+/// @brief Builds a shared_resources in several steps, tracking the filled slots in its type
+/// @tparam Bundle The shared_resources to build
+/// @tparam Filled The types set so far
+/// @note Resources are constructed in place in a staging area allocated once, which every builder of a chain hands
+///       over to the next, so set() never moves the resources set before. build() moves each resource exactly once
+///       into the bundle and compiles only when every slot is filled.
+///
+template <shared_resources_concept Bundle, typename... Filled>
+class builder
+{
+private:
+    /// @brief The effective type_list of the bundle
+    using list = typename Bundle::resource_list;
+
+    /// @brief The staging area
+    using staging_type = internals::builder_staging<list>;
+
+public:
+    ///
+    /// @brief Constructs an empty builder
+    ///
+    builder()
+        requires(sizeof...(Filled) == 0)
+        : staging_(std::make_unique<staging_type>())
+    {
+    }
+
+    builder(builder &&) noexcept            = default;
+    builder &operator=(builder &&) noexcept = default;
+
+    ///
+    /// @brief Constructs the resource of type U in place
+    /// @tparam U The type of the resource
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the resource with
+    /// @return The builder with U filled; this builder is left empty
+    ///
+    template <typename U, typename... Args>
+        requires internals::contains_concept<U, list> && (!internals::contains<U, type_list<Filled...>>::value)
+              && std::constructible_from<U, Args...>
+    builder<Bundle, Filled..., U> set(Args &&...args) &&
+    {
+        std::get<internals::index_of<U, list>::value>(staging_->values).emplace(std::forward<Args>(args)...);
+        return builder<Bundle, Filled..., U>(std::move(staging_));
+    }
+
+    ///
+    /// @brief Checks if the resource of type U is set
+    /// @tparam U The type of the resource
+    /// @return true if U is filled
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, list>
+    static constexpr bool filled() noexcept
+    {
+        return internals::contains<U, type_list<Filled...>>::value;
+    }
+
+    ///
+    /// @brief Moves the resources into a bundle
+    /// @return The bundle
+    ///
+    Bundle build() &&
+        requires(sizeof...(Filled) == internals::type_list_size<list>::value)
+    {
+        return build(std::make_index_sequence<sizeof...(Filled)>{});
+    }
+
+private:
+    ///
+    /// @brief Constructs a builder taking over a staging area
+    /// @param staging The staging area
+    ///
+    explicit builder(std::unique_ptr<staging_type> staging) noexcept
+        : staging_(std::move(staging))
+    {
+    }
+
+    ///
+    /// @brief Moves the resources into a bundle
+    /// @tparam Indices The indices of the types in the effective type list
+    /// @return The bundle
+    ///
+    template <std::size_t... Indices>
+    Bundle build(std::index_sequence<Indices...>)
+    {
+        return Bundle(in_order, std::move(*std::get<Indices>(staging_->values))...);
+    }
+
+    /// @brief The staging area
+    std::unique_ptr<staging_type> staging_;
+
+    template <shared_resources_concept, typename...>
+    friend class builder;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_BUILDER_HPP
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file child_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_CHILD_RESOURCES_HPP
+#define SHARED_RESOURCES_CHILD_RESOURCES_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+template <typename Parent, type_list_concept List, typename... Exclude>
+class child_resources;
+
+///
+/// @brief Trait to check if a type is a child_resources
+/// @tparam T The type to check
+/// @note Inherits from std::true_type if T is a child_resources, otherwise std::false_type
+///
+template <typename T>
+struct is_child_resources
+    : public std::false_type
+{
+};
+
+template <typename Parent, type_list_concept List, typename... Exclude>
+struct is_child_resources<child_resources<Parent, List, Exclude...>>
+    : public std::true_type
+{
+};
+
+/// @brief Concept to ensure a type is a child_resources
+template <typename T>
+concept child_resources_concept = is_child_resources<T>::value;
+
+///
+/// @brief Provides its own shared resources and those of a parent bundle without copying them
+/// @tparam Parent The type of the parent bundle, possibly const, such as a shared_resources, shared_references or child_resources
+/// @tparam List A type_list of resource types owned by the child
+/// @tparam Exclude The types to exclude from List
+/// @note Resources of the child shadow resources of the same type in the parent.
+///       The parent must outlive the child.
+///
+template <typename Parent, type_list_concept List, typename... Exclude>
+class child_resources
+{
+    static_assert(bundle_concept<Parent>, "Parent must provide resource_list and get<T>()");
+
+private:
+    /// @brief The bundle of the resources owned by the child
+    using own_type = shared_resources<List, Exclude...>;
+
+    /// @brief The list of types owned by the child
+    using own_list = typename own_type::resource_list;
+
+    /// @brief The list of types provided by the parent
+    using parent_list = typename std::remove_const_t<Parent>::resource_list;
+
+public:
+    /// @brief The effective type_list of the provided resources, own types first
+    using resource_list = typename internals::concat<own_list, typename internals::remove_list<parent_list, own_list>::type>::type;
+
+    ///
+    /// @brief Constructs child_resources with a parent and the resources owned by the child
+    /// @tparam Args The types of the arguments
+    /// @param parent The parent bundle
+    /// @param args The arguments to construct the owned resources
+    ///
+    template <typename... Args>
+        requires std::constructible_from<own_type, Args...>
+    constexpr child_resources(Parent &parent, Args &&...args) noexcept
+        : parent_(std::addressof(parent)), own_(std::forward<Args>(args)...)
+    {
+    }
+
+    ///
+    /// @brief Gets a reference to the resource of type U, from the child if it owns one, otherwise from the parent
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr decltype(auto) get() noexcept
+    {
+        if constexpr (internals::contains<U, own_list>::value)
+        {
+            return own_.template get<U>();
+        }
+        else
+        {
+            return parent_->template get<U>();
+        }
+    }
+
+    ///
+    /// @brief Gets a const reference to the resource of type U, from the child if it owns one, otherwise from the parent
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr decltype(auto) get() const noexcept
+    {
+        if constexpr (internals::contains<U, own_list>::value)
+        {
+            return own_.template get<U>();
+        }
+        else
+        {
+            return std::as_const(*parent_).template get<U>();
+        }
+    }
+
+    ///
+    /// @brief Gets the parent bundle
+    /// @return A reference to the parent bundle
+    ///
+    constexpr Parent &parent() const noexcept
+    {
+        return *parent_;
+    }
+
+private:
+    /// @brief The parent bundle
+    Parent *parent_;
+
+    /// @brief The resources owned by the child
+    own_type own_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_CHILD_RESOURCES_HPP
@@ -0,0 +1,646 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file concurrent_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_CONCURRENT_RESOURCES_HPP
+#define SHARED_RESOURCES_CONCURRENT_RESOURCES_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/epoch.hpp>
+#include <shared_resources/reclaimer.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+
+/// @brief A function running a task, e.g. by posting it to a thread pool
+using executor_type = std::function<void(std::function<void()>)>;
+
+/// @brief An executor running each task immediately on the calling thread
+/// @note Subscribed with it, a callback runs on the writer thread before store(), update() or commit() returns, so
+///       each write gets its own callback; only changes made by other writers during a callback are coalesced.
+inline executor_type const inline_executor = [](std::function<void()> task) { task(); };
+
+///
+/// @brief The set of resource types that changed
+/// @tparam List The effective type_list of the bundle
+///
+template <type_list_concept List>
+class change_set
+{
+    static_assert(internals::type_list_size<List>::value <= 64, "change_set supports up to 64 resource types");
+
+public:
+    ///
+    /// @brief Constructs a change_set from a bitmask
+    /// @param mask The bitmask, with bit i set if the i-th type of List changed
+    ///
+    constexpr explicit change_set(std::uint64_t mask) noexcept
+        : mask_(mask)
+    {
+    }
+
+    ///
+    /// @brief Checks if the resource of type T changed
+    /// @tparam T The type of the resource
+    /// @return true if the resource changed
+    ///
+    template <typename T>
+        requires internals::contains_concept<T, List>
+    constexpr bool contains() const noexcept
+    {
+        return (mask_ & of<T>().mask()) != 0;
+    }
+
+    ///
+    /// @brief Gets the bitmask of the changed types
+    /// @return The bitmask, with bit i set if the i-th type of List changed
+    ///
+    constexpr std::uint64_t mask() const noexcept
+    {
+        return mask_;
+    }
+
+    ///
+    /// @brief Creates the change_set of the given types
+    /// @tparam Types The types, or none for every type of List
+    /// @return The change_set
+    ///
+    template <typename... Types>
+        requires internals::contains_all_concept<type_list<Types...>, List>
+    static constexpr change_set of() noexcept
+    {
+        if constexpr (sizeof...(Types) == 0)
+        {
+            constexpr std::size_t size = internals::type_list_size<List>::value;
+            return change_set(size == 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << size) - 1);
+        }
+        else
+        {
+            return change_set(((std::uint64_t{ 1 } << internals::index_of<Types, List>::value) | ...));
+        }
+    }
+
+private:
+    /// @brief The bitmask of the changed types
+    std::uint64_t mask_;
+};
+
+namespace internals
+{
+
+///
+/// @brief Wraps each type in a type_list with std::shared_ptr to const
+///
+template <type_list_concept List>
+struct wrap_with_shared_ptr;
+
+template <typename... Types>
+struct wrap_with_shared_ptr<type_list<Types...>>
+{
+    using type = type_list<std::shared_ptr<Types const>...>;
+};
+
+///
+/// @brief A subscriber to the changes of a concurrent_resources
+///
+struct subscriber
+{
+    /// @brief The bitmask of the types the subscriber is interested in
+    std::uint64_t interest;
+
+    /// @brief The function called with the bitmask of the changed types
+    std::function<void(std::uint64_t)> callback;
+
+    /// @brief The executor running the callback
+    executor_type executor;
+
+    /// @brief The changes not delivered yet
+    std::atomic<std::uint64_t> pending{ 0 };
+
+    /// @brief Whether a delivery is scheduled on the executor
+    std::atomic<bool> scheduled{ false };
+
+    /// @brief Whether the subscription is alive
+    std::atomic<bool> active{ true };
+};
+
+inline void schedule(std::shared_ptr<subscriber> const &target) noexcept;
+
+///
+/// @brief Posts a delivery of the pending changes of a subscriber to its executor
+/// @param target The subscriber, whose scheduled flag is set
+///
+inline void post(std::shared_ptr<subscriber> const &target)
+{
+    target->executor([target] {
+        struct reschedule
+        {
+            std::shared_ptr<subscriber> const &target;
+
+            ~reschedule()
+            {
+                target->scheduled.store(false);
+                if (target->pending.load() != 0 && target->active.load())
+                {
+                    schedule(target);
+                }
+            }
+        } const guard{ target };
+
+        std::uint64_t const batch = target->pending.exchange(0);
+        if (batch != 0 && target->active.load())
+        {
+            try
+            {
+                target->callback(batch);
+            }
+            catch (...)
+            {
+                // Neither the writer nor the other subscribers see the exception
+            }
+        }
+    });
+}
+
+///
+/// @brief Schedules a delivery of the pending changes of a subscriber unless one is already scheduled or running
+/// @param target The subscriber
+/// @note scheduled stays set until the callback returns, so callbacks of one subscriber never overlap; changes
+///       recorded during a callback are delivered by a delivery scheduled after it. An exception thrown by the
+///       callback is dropped with its batch. If the executor throws, the changes stay pending and are posted again
+///       with the next change.
+///
+inline void schedule(std::shared_ptr<subscriber> const &target) noexcept
+{
+    if (target->scheduled.exchange(true))
+    {
+        return;
+    }
+    try
+    {
+        post(target);
+    }
+    catch (...)
+    {
+        target->scheduled.store(false);
+    }
+}
+
+///
+/// @brief Records changes for a subscriber and schedules their delivery unless one is already scheduled
+/// @param target The subscriber
+/// @param changed The bitmask of the changed types
+/// @note Changes recorded before a scheduled delivery runs are delivered together in one callback
+///
+inline void notify(std::shared_ptr<subscriber> const &target, std::uint64_t changed)
+{
+    changed &= target->interest;
+    if (changed == 0 || !target->active.load())
+    {
+        return;
+    }
+    target->pending.fetch_or(changed);
+    schedule(target);
+}
+
+}  // namespace internals
+
+///
+/// @brief Keeps a subscription to the changes of a concurrent_resources alive
+/// @note Destroying or resetting the subscription stops future deliveries; a delivery already running completes.
+///
+class subscription
+{
+public:
+    ///
+    /// @brief Constructs an empty subscription
+    ///
+    subscription() noexcept = default;
+
+    subscription(subscription &&) noexcept = default;
+
+    ///
+    /// @brief Move assignment operator; cancels the current subscription first
+    /// @param other The subscription to take over
+    /// @return This subscription
+    ///
+    subscription &operator=(subscription &&other) noexcept
+    {
+        if (this != std::addressof(other))
+        {
+            reset();
+            subscriber_ = std::move(other.subscriber_);
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Cancels the subscription
+    ///
+    ~subscription()
+    {
+        reset();
+    }
+
+    ///
+    /// @brief Cancels the subscription
+    ///
+    void reset() noexcept
+    {
+        if (subscriber_)
+        {
+            subscriber_->active.store(false);
+            subscriber_.reset();
+        }
+    }
+
+private:
+    ///
+    /// @brief Constructs a subscription
+    /// @param target The subscriber
+    ///
+    explicit subscription(std::shared_ptr<internals::subscriber> target) noexcept
+        : subscriber_(std::move(target))
+    {
+    }
+
+    /// @brief The subscriber
+    std::shared_ptr<internals::subscriber> subscriber_;
+
+    template <type_list_concept, typename...>
+    friend class concurrent_resources;
+};
+
+///
+/// @brief Provides shared resources that many threads read without locks while others replace them
+/// @tparam List A type_list of resource types to share
+/// @tparam Exclude The types to exclude from List
+/// @note Readers see an immutable snapshot of all resources. Writers copy the snapshot, which shares the unchanged
+///       resources, replace resources in the copy and publish it with one atomic store; the old snapshot is freed
+///       once no reader can see it. A transaction replaces several resources in one such snapshot switch.
+///
+template <type_list_concept List, typename... Exclude>
+class concurrent_resources
+{
+private:
+    /// @brief The list of types after excluding specified types
+    using list = typename internals::remove_types<List, Exclude...>::type;
+
+    /// @brief An immutable snapshot of the resources
+    using snapshot_type = shared_resources<typename internals::wrap_with_shared_ptr<list>::type>;
+
+public:
+    /// @brief The effective type_list of the stored resources
+    using resource_list = list;
+
+    ///
+    /// @brief A consistent view of the resources; references it returns stay valid until it is destroyed
+    ///
+    class read_view
+    {
+    public:
+        /// @brief The effective type_list of the viewed resources
+        using resource_list = list;
+
+        read_view(read_view const &)            = delete;
+        read_view &operator=(read_view const &) = delete;
+
+        ///
+        /// @brief Gets a const reference to the resource of type U
+        /// @tparam U The type of the resource to get
+        /// @return A const reference to the resource of type U
+        ///
+        template <typename U>
+            requires internals::contains_concept<U, list>
+        U const &get() const noexcept
+        {
+            return *snapshot_->template get<std::shared_ptr<U const>>();
+        }
+
+    private:
+        ///
+        /// @brief Enters a read-side critical section and loads the current snapshot
+        /// @param owner The concurrent_resources to view
+        ///
+        explicit read_view(concurrent_resources const &owner) noexcept
+            : guard_(owner.domain_.enter()), snapshot_(owner.snapshot_.load(std::memory_order_acquire))
+        {
+        }
+
+        /// @brief The read-side critical section
+        internals::epoch_domain::guard guard_;
+
+        /// @brief The viewed snapshot
+        snapshot_type const *snapshot_;
+
+        friend class concurrent_resources;
+    };
+
+    ///
+    /// @brief Constructs concurrent_resources with the given arguments
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the shared resources
+    ///
+    template <typename... Args>
+        requires internals::contains_all_concept<list, type_list<Args...>>
+    explicit concurrent_resources(Args... args)
+        : snapshot_(new snapshot_type(std::make_shared<Args const>(std::move(args))...))
+    {
+    }
+
+    concurrent_resources(concurrent_resources const &)            = delete;
+    concurrent_resources &operator=(concurrent_resources const &) = delete;
+
+    ///
+    /// @brief Destroys the resources
+    /// @note No read_view may be alive
+    ///
+    ~concurrent_resources()
+    {
+        domain_.retire(snapshot_.load());
+    }
+
+    ///
+    /// @brief Hands the destruction of replaced resources, and of the last ones at teardown, to a reclaimer
+    /// @param target The reclaimer, which must outlive the concurrent_resources
+    /// @note Resources are destroyed with the snapshot that last refers to them, so a large resource replaced by a
+    ///       writer is destroyed on the reclaimer thread instead of the writer thread.
+    ///       If the queue of the reclaimer is full, the objects are destroyed inline instead of waiting for room.
+    ///
+    void defer_destruction(reclaimer &target)
+    {
+        domain_.defer_to(std::addressof(target));
+    }
+
+    ///
+    /// @brief Gets a consistent view of the resources
+    /// @return The view
+    ///
+    read_view read() const noexcept
+    {
+        return read_view(*this);
+    }
+
+    ///
+    /// @brief Gets the current resource of type U, kept alive by the returned pointer
+    /// @tparam U The type of the resource to get
+    /// @return A shared pointer to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, list>
+    std::shared_ptr<U const> load() const noexcept
+    {
+        auto const guard = domain_.enter();
+        return snapshot_.load(std::memory_order_acquire)->template get<std::shared_ptr<U const>>();
+    }
+
+    ///
+    /// @brief Replaces the resource of type U
+    /// @tparam U The type of the resource
+    /// @param value The new resource
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, list>
+    void store(U value)
+    {
+        auto replacement = std::make_shared<U const>(std::move(value));
+        write(change_set<list>::template of<U>().mask(),
+              [&](snapshot_type &next) { next.template get<std::shared_ptr<U const>>() = std::move(replacement); });
+    }
+
+    ///
+    /// @brief Replaces the resource of type U by a modified copy, atomically with respect to other writers
+    /// @tparam U The type of the resource
+    /// @tparam Fn The type of the function
+    /// @param fn The function modifying the copy through a U&
+    ///
+    template <typename U, typename Fn>
+        requires internals::contains_concept<U, list> && std::invocable<Fn &, U &>
+    void update(Fn &&fn)
+    {
+        write(change_set<list>::template of<U>().mask(), [&](snapshot_type &next) { modify<U>(next, fn); });
+    }
+
+    ///
+    /// @brief Stages changes to several resources and publishes them together
+    /// @note Readers see either none or all of the changes of a committed transaction, and pay nothing extra for it
+    ///
+    class transaction
+    {
+    public:
+        transaction(transaction &&) noexcept            = default;
+        transaction &operator=(transaction &&) noexcept = default;
+
+        ///
+        /// @brief Stages the replacement of the resource of type U
+        /// @tparam U The type of the resource
+        /// @param value The new resource
+        /// @return This transaction
+        ///
+        template <typename U>
+            requires internals::contains_concept<U, list>
+        transaction &store(U value)
+        {
+            steps_.push_back([replacement = std::make_shared<U const>(std::move(value))](snapshot_type &next) {
+                next.template get<std::shared_ptr<U const>>() = replacement;
+            });
+            changed_ |= change_set<list>::template of<U>().mask();
+            return *this;
+        }
+
+        ///
+        /// @brief Stages a modification of the resource of type U
+        /// @tparam U The type of the resource
+        /// @tparam Fn The type of the function
+        /// @param fn The function modifying a copy through a U&; it runs at commit, on the latest value including the
+        ///           changes staged before it
+        /// @return This transaction
+        ///
+        template <typename U, typename Fn>
+            requires internals::contains_concept<U, list> && std::invocable<std::decay_t<Fn> &, U &>
+        transaction &update(Fn &&fn)
+        {
+            steps_.push_back([fn = std::forward<Fn>(fn)](snapshot_type &next) mutable { modify<U>(next, fn); });
+            changed_ |= change_set<list>::template of<U>().mask();
+            return *this;
+        }
+
+        ///
+        /// @brief Publishes the staged changes as one snapshot and clears the transaction
+        /// @note If a staged modification throws, nothing is published and the transaction keeps its changes
+        ///
+        void commit()
+        {
+            if (steps_.empty())
+            {
+                return;
+            }
+            owner_->write(changed_, [this](snapshot_type &next) {
+                for (auto &step : steps_)
+                {
+                    step(next);
+                }
+            });
+            steps_.clear();
+            changed_ = 0;
+        }
+
+    private:
+        ///
+        /// @brief Constructs an empty transaction
+        /// @param owner The concurrent_resources to change
+        ///
+        explicit transaction(concurrent_resources &owner) noexcept
+            : owner_(std::addressof(owner))
+        {
+        }
+
+        /// @brief The concurrent_resources to change
+        concurrent_resources *owner_;
+
+        /// @brief The staged changes, applied in order to a copy of the latest snapshot
+        std::vector<std::function<void(snapshot_type &)>> steps_;
+
+        /// @brief The bitmask of the staged types
+        std::uint64_t changed_ = 0;
+
+        friend class concurrent_resources;
+    };
+
+    ///
+    /// @brief Starts a transaction
+    /// @return An empty transaction; discarding it without commit() discards its changes
+    ///
+    [[nodiscard]] transaction begin_transaction() noexcept
+    {
+        return transaction(*this);
+    }
+
+    ///
+    /// @brief Subscribes to changes of the resources of the given types
+    /// @tparam Types The types to watch, or none for every type
+    /// @tparam Fn The type of the callback
+    /// @param callback The function called with the change_set of the watched types that changed
+    /// @param executor The executor running the callback
+    /// @return The subscription, which must be kept alive to keep receiving changes
+    /// @note The callback never runs inside a writer's critical section. Changes made before a scheduled callback runs
+    ///       are delivered together, so a burst of updates costs one callback per subscriber per batch.
+    ///
+    template <typename... Types, typename Fn>
+        requires internals::contains_all_concept<type_list<Types...>, list> && std::invocable<Fn &, change_set<list>>
+    [[nodiscard]] subscription subscribe(Fn callback, executor_type executor = inline_executor)
+    {
+        auto target       = std::make_shared<internals::subscriber>();
+        target->interest  = change_set<list>::template of<Types...>().mask();
+        target->callback  = [callback = std::move(callback)](std::uint64_t changed) mutable { callback(change_set<list>(changed)); };
+        target->executor  = std::move(executor);
+
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+        auto subscribers = std::make_shared<std::vector<std::shared_ptr<internals::subscriber>>>();
+        if (subscribers_)
+        {
+            for (auto const &existing : *subscribers_)
+            {
+                if (existing->active.load())
+                {
+                    subscribers->push_back(existing);
+                }
+            }
+        }
+        subscribers->push_back(target);
+        subscribers_ = std::move(subscribers);
+        return subscription(std::move(target));
+    }
+
+private:
+    ///
+    /// @brief Replaces the resource of type U in a snapshot by a modified copy
+    /// @tparam U The type of the resource
+    /// @tparam Fn The type of the function
+    /// @param next The snapshot
+    /// @param fn The function modifying the copy through a U&
+    ///
+    template <typename U, typename Fn>
+    static void modify(snapshot_type &next, Fn &fn)
+    {
+        auto &slot = next.template get<std::shared_ptr<U const>>();
+        U modified = *slot;
+        fn(modified);
+        slot = std::make_shared<U const>(std::move(modified));
+    }
+
+    ///
+    /// @brief Publishes a changed copy of the latest snapshot, retires the previous one and notifies the subscribers
+    /// @tparam Fn The type of the function
+    /// @param changed The bitmask of the types that apply changes
+    /// @param apply The function changing the copy; if it throws, nothing is published
+    ///
+    template <typename Fn>
+    void write(std::uint64_t changed, Fn &&apply)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto next = std::make_unique<snapshot_type>(*snapshot_.load());
+            apply(*next);
+            snapshot_type *const previous = snapshot_.exchange(next.release(), std::memory_order_acq_rel);
+            domain_.retire(previous);
+        }
+        notify(changed);
+    }
+
+    ///
+    /// @brief Notifies the subscribers of changes
+    /// @param changed The bitmask of the changed types
+    ///
+    void notify(std::uint64_t changed)
+    {
+        std::shared_ptr<std::vector<std::shared_ptr<internals::subscriber>> const> subscribers;
+        {
+            std::lock_guard<std::mutex> lock(subscribers_mutex_);
+            subscribers = subscribers_;
+        }
+        if (subscribers)
+        {
+            for (auto const &target : *subscribers)
+            {
+                internals::notify(target, changed);
+            }
+        }
+    }
+
+    /// @brief The published snapshot
+    std::atomic<snapshot_type *> snapshot_;
+
+    /// @brief Reclaims replaced snapshots
+    mutable internals::epoch_domain domain_;
+
+    /// @brief Serializes writers
+    std::mutex mutex_;
+
+    /// @brief Guards subscribers_
+    std::mutex subscribers_mutex_;
+
+    /// @brief The subscribers, replaced as a whole when one subscribes
+    std::shared_ptr<std::vector<std::shared_ptr<internals::subscriber>> const> subscribers_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_CONCURRENT_RESOURCES_HPP
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file derived_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_DERIVED_RESOURCES_HPP
+#define SHARED_RESOURCES_DERIVED_RESOURCES_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/versioned_resources.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Declares a resource computed from other resources
+/// @tparam T The type of the computed resource
+/// @tparam Dependencies A type_list of the resources T is computed from; stored or derived resources
+/// @tparam Compute A default-constructible function object computing T from const references to Dependencies, in order
+///
+template <typename T, type_list_concept Dependencies, typename Compute>
+struct derived
+{
+    /// @brief The type of the computed resource
+    using type = T;
+
+    /// @brief The resources T is computed from
+    using dependencies = Dependencies;
+
+    /// @brief The function object computing T
+    using compute = Compute;
+};
+
+namespace internals
+{
+
+///
+/// @brief The cache of a derived resource
+/// @tparam Derived The derived declaration
+///
+template <typename Derived>
+struct derived_slot;
+
+template <typename T, typename... Dependencies, typename Compute>
+struct derived_slot<derived<T, type_list<Dependencies...>, Compute>>
+{
+    /// @brief The computed resource, empty until first accessed
+    std::optional<T> value;
+
+    /// @brief The generations of the dependencies the value was computed from
+    std::array<std::uint64_t, sizeof...(Dependencies)> seen{};
+
+    /// @brief The number of times the value was computed
+    std::uint64_t generation = 0;
+};
+
+///
+/// @brief Gets the list of the types of derived declarations
+/// @tparam Derived The derived declarations
+///
+template <typename... Derived>
+struct derived_types
+{
+    using type = type_list<typename Derived::type...>;
+};
+
+}  // namespace internals
+
+///
+/// @brief Provides stored resources and resources computed from them, recomputing a computed resource only when one of its
+///        dependencies changed since it was last computed
+/// @tparam Base The versioned_resources holding the stored resources
+/// @tparam Derived derived declarations of the computed resources
+/// @note A computed resource is computed on first access and cached. Changes are detected through the generations of
+///       the stored resources, so mutable access to a stored resource invalidates every resource computed from it.
+///       Like versioned_resources, derived_resources is not synchronized. Since the const get() and generation()
+///       write the cache of an out-of-date computed resource, even concurrent const reads need external locking.
+///
+template <typename Base, typename... Derived>
+class derived_resources
+{
+private:
+    /// @brief The list of the stored types
+    using base_list = typename Base::resource_list;
+
+    /// @brief The list of the computed types
+    using derived_list = typename internals::derived_types<Derived...>::type;
+
+    /// @brief The declaration of the computed type U
+    template <typename U>
+    using declaration_of = std::tuple_element_t<internals::index_of<U, derived_list>::value, std::tuple<Derived...>>;
+
+public:
+    /// @brief The effective type_list of the stored and computed resources
+    using resource_list = typename internals::concat<base_list, derived_list>::type;
+
+    ///
+    /// @brief Constructs derived_resources with the arguments of the stored resources
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct Base with
+    ///
+    template <typename... Args>
+        requires std::constructible_from<Base, Args...>
+    constexpr derived_resources(Args &&...args)
+        : base_(std::forward<Args>(args)...)
+    {
+    }
+
+    ///
+    /// @brief Gets a reference to the stored resource of type U, which invalidates the resources computed from it
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the stored resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, base_list>
+    constexpr U &get() noexcept
+    {
+        return base_.template get<U>();
+    }
+
+    ///
+    /// @brief Gets a const reference to the resource of type U, computing it first if it is derived and out of date
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr U const &get() const
+    {
+        if constexpr (internals::contains<U, base_list>::value)
+        {
+            return base_.template get<U>();
+        }
+        else
+        {
+            return *refresh<U>().value;
+        }
+    }
+
+    ///
+    /// @brief Bumps the generation of the stored resource of type U, which invalidates the resources computed from it
+    /// @tparam U The type of the stored resource
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, base_list>
+    constexpr void touch() noexcept
+    {
+        base_.template touch<U>();
+    }
+
+    ///
+    /// @brief Gets the generation of the resource of type U
+    /// @tparam U The type of the resource
+    /// @return For a stored resource, its generation in Base; for a derived resource, the number of times it was computed,
+    ///         after computing it if it is out of date
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr std::uint64_t generation() const
+    {
+        if constexpr (internals::contains<U, base_list>::value)
+        {
+            return base_.template generation<U>();
+        }
+        else
+        {
+            return refresh<U>().generation;
+        }
+    }
+
+    ///
+    /// @brief Gets the stored resources without invalidating anything
+    /// @return A const reference to Base
+    ///
+    constexpr Base const &base() const noexcept
+    {
+        return base_;
+    }
+
+private:
+    ///
+    /// @brief Computes the derived resource of type U if it was never computed or a dependency changed
+    /// @tparam U The type of the derived resource
+    /// @return The cache of the resource
+    ///
+    template <typename U>
+    constexpr internals::derived_slot<declaration_of<U>> &refresh() const
+    {
+        return refresh(std::get<internals::index_of<U, derived_list>::value>(slots_), declaration_of<U>{});
+    }
+
+    template <typename T, typename... Dependencies, typename Compute>
+    constexpr internals::derived_slot<derived<T, type_list<Dependencies...>, Compute>> &refresh(internals::derived_slot<derived<T, type_list<Dependencies...>, Compute>> &slot, derived<T, type_list<Dependencies...>, Compute>) const
+    {
+        std::array<std::uint64_t, sizeof...(Dependencies)> const current{ generation<Dependencies>()... };
+        if (!slot.value || current != slot.seen)
+        {
+            slot.value.emplace(Compute{}(get<Dependencies>()...));
+            slot.seen = current;
+            ++slot.generation;
+        }
+        return slot;
+    }
+
+    /// @brief The stored resources
+    Base base_;
+
+    /// @brief The caches of the derived resources
+    mutable std::tuple<internals::derived_slot<Derived>...> slots_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_DERIVED_RESOURCES_HPP
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file epoch.hpp
+///
+
+#ifndef SHARED_RESOURCES_EPOCH_HPP
+#define SHARED_RESOURCES_EPOCH_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+namespace internals
+{
+
+/// @brief The type of a function destroying a retired object
+using deleter_type = void (*)(void *) noexcept;
+
+///
+/// @brief Epoch-based reclamation of objects that lock-free readers may still see
+/// @note Readers enter a guard, which increments a striped counter of the current epoch. Objects are retired after
+///       being unpublished and are freed once no reader of the epoch they were retired in is left. Nothing blocks:
+///       each retirement frees what it can and flips the epoch when the previous one has no readers.
+///
+class epoch_domain
+{
+public:
+    ///
+    /// @brief A read-side critical section; objects seen inside it stay alive until it ends
+    ///
+    class guard
+    {
+    public:
+        ///
+        /// @brief Leaves the critical section
+        ///
+        ~guard()
+        {
+            domain_->readers_[epoch_][stripe_].count.fetch_sub(1);
+        }
+
+        guard(guard const &)            = delete;
+        guard &operator=(guard const &) = delete;
+
+    private:
+        ///
+        /// @brief Enters a critical section
+        /// @param domain The domain to enter
+        ///
+        explicit guard(epoch_domain &domain) noexcept
+            : domain_(std::addressof(domain)), stripe_(thread_stripe())
+        {
+            for (;;)
+            {
+                epoch_ = domain_->epoch_.load();
+                domain_->readers_[epoch_][stripe_].count.fetch_add(1);
+                if (domain_->epoch_.load() == epoch_)
+                {
+                    break;
+                }
+                domain_->readers_[epoch_][stripe_].count.fetch_sub(1);
+            }
+        }
+
+        ///
+        /// @brief Gets the reader counter stripe of the current thread
+        /// @return The stripe index
+        ///
+        static std::size_t thread_stripe() noexcept
+        {
+            static std::atomic<std::size_t> next{ 0 };
+            thread_local std::size_t const stripe = next.fetch_add(1, std::memory_order_relaxed) % stripes;
+            return stripe;
+        }
+
+        /// @brief The domain
+        epoch_domain *domain_;
+
+        /// @brief The reader counter stripe of the thread
+        std::size_t stripe_;
+
+        /// @brief The epoch the guard entered in
+        std::size_t epoch_ = 0;
+
+        friend class epoch_domain;
+    };
+
+    ///
+    /// @brief Default constructor
+    ///
+    epoch_domain() noexcept = default;
+
+    epoch_domain(epoch_domain const &)            = delete;
+    epoch_domain &operator=(epoch_domain const &) = delete;
+
+    ///
+    /// @brief Frees every retired object
+    /// @note No guard may be alive
+    ///
+    ~epoch_domain()
+    {
+        free(0);
+        free(1);
+    }
+
+    ///
+    /// @brief Enters a read-side critical section
+    /// @return The guard of the critical section
+    ///
+    guard enter() noexcept
+    {
+        return guard(*this);
+    }
+
+    ///
+    /// @brief Retires an object allocated with new that is no longer reachable by new readers
+    /// @tparam T The type of the object
+    /// @param retired The object
+    ///
+    template <typename T>
+    void retire(T *retired)
+    {
+        retire(retired, [](void *object) noexcept { delete static_cast<T *>(object); });
+    }
+
+    ///
+    /// @brief Retires an object that is no longer reachable by new readers
+    /// @param retired The object
+    /// @param deleter The function destroying the object once no reader can see it
+    ///
+    void retire(void *retired, deleter_type deleter)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retired_[epoch_.load()].push_back({ retired, deleter });
+        reclaim();
+    }
+
+    ///
+    /// @brief Hands the destruction of reclaimable objects to a reclaimer instead of running it on the retiring thread
+    /// @tparam Target The type of the reclaimer, whose try_retire() takes an object without blocking
+    /// @param target The reclaimer, which must outlive the domain, or nullptr to destroy objects inline again
+    /// @note An object the reclaimer has no room for is destroyed inline, so retiring never waits for the reclaimer
+    ///
+    template <typename Target>
+        requires requires(Target &target, void *object, deleter_type deleter) {
+            { target.try_retire(object, deleter) } noexcept -> std::same_as<bool>;
+        }
+    void defer_to(Target *target)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deferred_ = target;
+        hand_off_ = [](void *deferred, void *object, deleter_type deleter) noexcept {
+            return static_cast<Target *>(deferred)->try_retire(object, deleter);
+        };
+    }
+
+private:
+    /// @brief The number of reader counter stripes per epoch
+    static constexpr std::size_t stripes = 16;
+
+    /// @brief A reader counter on its own cache line
+    struct alignas(64) reader_count
+    {
+        std::atomic<std::size_t> count{ 0 };
+    };
+
+    ///
+    /// @brief Frees what was retired in the previous epoch if no reader of that epoch is left, then starts a new epoch
+    /// @note The mutex must be held
+    ///
+    void reclaim()
+    {
+        std::size_t const previous = epoch_.load() ^ 1;
+        for (auto const &reader : readers_[previous])
+        {
+            if (reader.count.load() != 0)
+            {
+                return;
+            }
+        }
+        free(previous);
+        epoch_.store(previous);
+    }
+
+    ///
+    /// @brief Frees what was retired in an epoch, through the reclaimer if there is one and it has room
+    /// @param epoch The epoch
+    /// @note The mutex must be held, except in the destructor
+    ///
+    void free(std::size_t epoch) noexcept
+    {
+        for (auto const &[object, deleter] : retired_[epoch])
+        {
+            if (deferred_ == nullptr || !hand_off_(deferred_, object, deleter))
+            {
+                deleter(object);
+            }
+        }
+        retired_[epoch].clear();
+    }
+
+    /// @brief The current epoch, 0 or 1
+    std::atomic<std::size_t> epoch_{ 0 };
+
+    /// @brief The number of readers per epoch, striped across cache lines
+    reader_count readers_[2][stripes];
+
+    /// @brief Serializes retirements
+    std::mutex mutex_;
+
+    /// @brief The reclaimer destroying reclaimable objects, if any; guarded by the mutex
+    void *deferred_ = nullptr;
+
+    /// @brief Hands an object to the reclaimer, returning false if it has no room; guarded by the mutex
+    bool (*hand_off_)(void *deferred, void *object, deleter_type deleter) noexcept = nullptr;
+
+    /// @brief The objects retired in each epoch with their deleters
+    std::vector<std::pair<void *, deleter_type>> retired_[2];
+};
+
+}  // namespace internals
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_EPOCH_HPP
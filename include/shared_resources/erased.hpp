@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file erased.hpp
+///
+
+#ifndef SHARED_RESOURCES_ERASED_HPP
+#define SHARED_RESOURCES_ERASED_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+namespace internals
+{
+
+///
+/// @brief Type-erased operations on a buffer holding an object either inline or as a pointer to the heap
+///
+struct erased_ops
+{
+    /// @brief Destroys the object in a buffer
+    void (*destroy)(void *buffer) noexcept;
+
+    /// @brief Move-constructs the buffer dst from src and destroys src
+    void (*relocate)(void *dst, void *src) noexcept;
+
+    /// @brief Copy-constructs the buffer dst from src
+    void (*copy)(void *dst, void const *src);
+
+    /// @brief Gets the address of the object in a buffer
+    void *(*get)(void *buffer) noexcept;
+
+    /// @brief The size of the buffer contents
+    std::size_t size;
+
+    /// @brief The alignment of the buffer contents
+    std::size_t align;
+
+    /// @brief Whether the object lives in the buffer rather than on the heap
+    bool inline_storage;
+};
+
+///
+/// @brief Checks if T is stored inline in a buffer of Size bytes
+/// @tparam T The type of the object
+/// @tparam Size The size of the buffer
+///
+template <typename T, std::size_t Size>
+inline constexpr bool erased_inline = sizeof(T) <= Size
+                                      && alignof(T) <= alignof(std::max_align_t)
+                                      && std::is_nothrow_move_constructible_v<T>;
+
+///
+/// @brief Creates the operations of a buffer of Size bytes holding T
+/// @tparam T The type of the object
+/// @tparam Size The size of the buffer
+/// @return The operations
+/// @note Small objects live in the buffer; others live on the heap and the buffer holds a pointer
+///
+template <typename T, std::size_t Size>
+constexpr erased_ops make_erased_ops() noexcept
+{
+    if constexpr (erased_inline<T, Size>)
+    {
+        return {
+            [](void *buffer) noexcept { static_cast<T *>(buffer)->~T(); },
+            [](void *dst, void *src) noexcept {
+                ::new (dst) T(std::move(*static_cast<T *>(src)));
+                static_cast<T *>(src)->~T();
+            },
+            [](void *dst, void const *src) { ::new (dst) T(*static_cast<T const *>(src)); },
+            [](void *buffer) noexcept -> void * { return buffer; },
+            sizeof(T),
+            alignof(T),
+            true,
+        };
+    }
+    else
+    {
+        return {
+            [](void *buffer) noexcept { delete *static_cast<T **>(buffer); },
+            [](void *dst, void *src) noexcept { ::new (dst) T *(*static_cast<T **>(src)); },
+            [](void *dst, void const *src) { ::new (dst) T *(new T(**static_cast<T *const *>(src))); },
+            [](void *buffer) noexcept -> void * { return *static_cast<T **>(buffer); },
+            sizeof(T *),
+            alignof(T *),
+            false,
+        };
+    }
+}
+
+/// @brief The operations of a buffer of Size bytes holding T
+template <typename T, std::size_t Size>
+inline constexpr erased_ops erased_ops_for = make_erased_ops<T, Size>();
+
+///
+/// @brief Constructs an object in a buffer of Size bytes, inline or on the heap as erased_ops_for expects
+/// @tparam T The type of the object
+/// @tparam Size The size of the buffer
+/// @tparam Args The types of the arguments
+/// @param buffer The buffer
+/// @param args The arguments to construct the object with
+///
+template <typename T, std::size_t Size, typename... Args>
+void erased_construct(void *buffer, Args &&...args)
+{
+    if constexpr (erased_inline<T, Size>)
+    {
+        ::new (buffer) T(std::forward<Args>(args)...);
+    }
+    else
+    {
+        ::new (buffer) T *(new T(std::forward<Args>(args)...));
+    }
+}
+
+}  // namespace internals
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_ERASED_HPP
@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file expiring.hpp
+///
+
+#ifndef SHARED_RESOURCES_EXPIRING_HPP
+#define SHARED_RESOURCES_EXPIRING_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/epoch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+
+///
+/// @brief Runs the refreshes of expiring resources on one background thread
+/// @note A refresher runs on the scheduler thread, so a slow refresher delays the other refreshes of the same
+///       scheduler; give slow sources a scheduler of their own.
+///
+class refresh_scheduler
+{
+public:
+    /// @brief The clock of the due times
+    using clock = std::chrono::steady_clock;
+
+    /// @brief A refresh, returning when to run it again or nothing to stop
+    using task_type = std::function<std::optional<clock::time_point>()>;
+
+    ///
+    /// @brief Starts the background thread
+    ///
+    refresh_scheduler()
+        : thread_([this] { run(); })
+    {
+    }
+
+    refresh_scheduler(refresh_scheduler const &)            = delete;
+    refresh_scheduler &operator=(refresh_scheduler const &) = delete;
+
+    ///
+    /// @brief Stops the background thread, dropping the pending refreshes
+    ///
+    ~refresh_scheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    ///
+    /// @brief Schedules a refresh
+    /// @param due When to run the refresh
+    /// @param task The refresh
+    ///
+    void schedule(clock::time_point due, task_type task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back({ due, std::move(task) });
+            std::push_heap(tasks_.begin(), tasks_.end(), later);
+        }
+        wake_.notify_one();
+    }
+
+private:
+    /// @brief A scheduled refresh
+    struct entry
+    {
+        /// @brief When to run the refresh
+        clock::time_point due;
+
+        /// @brief The refresh
+        task_type task;
+    };
+
+    ///
+    /// @brief Orders entries so that the heap yields the earliest due time first
+    ///
+    static bool later(entry const &lhs, entry const &rhs) noexcept
+    {
+        return lhs.due > rhs.due;
+    }
+
+    ///
+    /// @brief Runs due refreshes until the scheduler is destroyed
+    ///
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_)
+        {
+            if (tasks_.empty())
+            {
+                wake_.wait(lock);
+                continue;
+            }
+            // Copied, since schedule() may reallocate tasks_ while the lock is released for the wait
+            clock::time_point const due = tasks_.front().due;
+            if (clock::now() < due)
+            {
+                wake_.wait_until(lock, due);
+                continue;
+            }
+
+            std::pop_heap(tasks_.begin(), tasks_.end(), later);
+            task_type task = std::move(tasks_.back().task);
+            tasks_.pop_back();
+
+            lock.unlock();
+            std::optional<clock::time_point> const next = task();
+            lock.lock();
+
+            if (next)
+            {
+                tasks_.push_back({ *next, std::move(task) });
+                std::push_heap(tasks_.begin(), tasks_.end(), later);
+            }
+        }
+    }
+
+    /// @brief Guards tasks_ and stopping_
+    std::mutex mutex_;
+
+    /// @brief Wakes the background thread when a refresh is scheduled or the scheduler stops
+    std::condition_variable wake_;
+
+    /// @brief The pending refreshes, as a min-heap on the due time
+    std::vector<entry> tasks_;
+
+    /// @brief Whether the scheduler is being destroyed
+    bool stopping_ = false;
+
+    /// @brief The background thread, started last
+    std::thread thread_;
+};
+
+///
+/// @brief A resource slot whose value expires and is refreshed in the background ahead of expiry
+/// @tparam T The type of the resource
+/// @note Readers never block on a refresh: they keep seeing the previous value until the refreshed one is published
+///       with one atomic store. A refresher that throws leaves the previous value in place and is retried. Copies of
+///       an expiring share the same value, so it can be stored in any bundle.
+///
+template <typename T>
+class expiring
+{
+public:
+    /// @brief The type of the resource
+    using value_type = T;
+
+    /// @brief The clock of the expiry times
+    using clock = refresh_scheduler::clock;
+
+    /// @brief The type of the function fetching a fresh value
+    using refresher_type = std::function<T()>;
+
+    ///
+    /// @brief Fetches the first value inline and schedules its refreshes
+    /// @param scheduler The scheduler running the refreshes; must outlive every copy of the slot
+    /// @param refresher The function fetching a fresh value
+    /// @param ttl How long a value stays valid
+    /// @param lead How long before expiry to refresh; a tenth of ttl if not given
+    /// @throw std::invalid_argument If ttl is not positive or lead is not in [0, ttl)
+    ///
+    expiring(refresh_scheduler &scheduler, refresher_type refresher, clock::duration ttl, std::optional<clock::duration> lead = std::nullopt)
+        : state_(std::make_shared<state>(std::move(refresher), ttl, checked_lead(ttl, lead.value_or(ttl / 10))))
+    {
+        state_->publish(state_->refresher());
+        scheduler.schedule(state_->due(), [weak = std::weak_ptr<state>(state_)]() -> std::optional<clock::time_point> {
+            std::shared_ptr<state> const alive = weak.lock();
+            return alive ? std::optional<clock::time_point>(alive->refresh()) : std::nullopt;
+        });
+    }
+
+    ///
+    /// @brief Gets the current value
+    /// @return A shared pointer keeping the value alive
+    ///
+    std::shared_ptr<T const> load() const noexcept
+    {
+        auto const guard = state_->domain.enter();
+        return state_->current.load(std::memory_order_acquire)->value;
+    }
+
+    ///
+    /// @brief Gets when the current value expires
+    /// @return The expiry time
+    ///
+    clock::time_point expires_at() const noexcept
+    {
+        auto const guard = state_->domain.enter();
+        return state_->current.load(std::memory_order_acquire)->expires;
+    }
+
+    ///
+    /// @brief Checks if the current value is past its expiry, e.g. because the refresher keeps failing
+    /// @return true if the current value has expired
+    ///
+    bool expired() const noexcept
+    {
+        return clock::now() >= expires_at();
+    }
+
+private:
+    ///
+    /// @brief Checks that a value is refreshed before it expires and no sooner than it is published
+    /// @param ttl How long a value stays valid
+    /// @param lead How long before expiry to refresh
+    /// @return lead
+    /// @throw std::invalid_argument If ttl is not positive or lead is not in [0, ttl)
+    ///
+    static clock::duration checked_lead(clock::duration ttl, clock::duration lead)
+    {
+        if (ttl <= clock::duration::zero() || lead < clock::duration::zero() || lead >= ttl)
+        {
+            throw std::invalid_argument("srs::expiring: ttl must be positive and lead must be in [0, ttl)");
+        }
+        return lead;
+    }
+
+    /// @brief A published value
+    struct version
+    {
+        /// @brief The value
+        std::shared_ptr<T const> value;
+
+        /// @brief When the value expires
+        clock::time_point expires;
+    };
+
+    /// @brief The state shared by the copies of the slot and the scheduled refresh
+    struct state
+    {
+        ///
+        /// @brief Constructs the state without a value
+        /// @param refresher The function fetching a fresh value
+        /// @param ttl How long a value stays valid
+        /// @param lead How long before expiry to refresh
+        ///
+        state(refresher_type refresher, clock::duration ttl, clock::duration lead)
+            : refresher(std::move(refresher)), ttl(ttl), lead(lead)
+        {
+        }
+
+        state(state const &)            = delete;
+        state &operator=(state const &) = delete;
+
+        ///
+        /// @brief Frees the current version
+        ///
+        ~state()
+        {
+            delete current.load();
+        }
+
+        ///
+        /// @brief Publishes a value valid for ttl from now and retires the previous one
+        /// @param value The value
+        ///
+        void publish(T value)
+        {
+            auto *const next = new version{ std::make_shared<T const>(std::move(value)), clock::now() + ttl };
+            if (version *const previous = current.exchange(next, std::memory_order_acq_rel))
+            {
+                domain.retire(previous);
+            }
+        }
+
+        ///
+        /// @brief Gets when to refresh the current version
+        /// @return The refresh time
+        ///
+        clock::time_point due() const noexcept
+        {
+            return current.load(std::memory_order_acquire)->expires - lead;
+        }
+
+        ///
+        /// @brief Fetches and publishes a fresh value
+        /// @return When to refresh next; half the lead from now if the refresher threw
+        ///
+        clock::time_point refresh()
+        {
+            try
+            {
+                publish(refresher());
+                return due();
+            }
+            catch (...)
+            {
+                return clock::now() + std::max<clock::duration>(lead / 2, std::chrono::milliseconds(1));
+            }
+        }
+
+        /// @brief The function fetching a fresh value
+        refresher_type refresher;
+
+        /// @brief How long a value stays valid
+        clock::duration ttl;
+
+        /// @brief How long before expiry to refresh
+        clock::duration lead;
+
+        /// @brief The published version
+        std::atomic<version *> current{ nullptr };
+
+        /// @brief Reclaims replaced versions
+        internals::epoch_domain domain;
+    };
+
+    /// @brief The shared state
+    std::shared_ptr<state> state_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_EXPIRING_HPP
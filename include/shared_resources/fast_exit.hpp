@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file fast_exit.hpp
+///
+
+#ifndef SHARED_RESOURCES_FAST_EXIT_HPP
+#define SHARED_RESOURCES_FAST_EXIT_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief What happens to a resource when a process_lifetime bundle is torn down
+///
+enum class teardown
+{
+    /// @brief The resource is destroyed
+    destroy,
+
+    /// @brief The destructor is skipped and the memory is left for the OS to reclaim; flush_hook still runs
+    leak,
+};
+
+///
+/// @brief Teardown policy of a resource of type T in a process_lifetime bundle
+/// @tparam T The resource type
+/// @note Specialize this trait to leak types whose destructors only free memory, such as large caches and indexes
+///
+template <typename T>
+struct teardown_policy
+    : public std::integral_constant<teardown, teardown::destroy>
+{
+};
+
+///
+/// @brief Work that must happen when a leaked resource of type T is torn down, such as flushing buffered output
+/// @tparam T The resource type
+/// @note Specialize this trait with a static noexcept run(T&) function; it runs only for leaked resources, since the
+///       destructor of a destroyed resource is expected to do its own flushing
+///
+template <typename T>
+struct flush_hook
+{
+    static void run(T &) noexcept
+    {
+    }
+};
+
+///
+/// @brief Holds a bundle that lives until process exit and tears it down without destroying its leaked resources
+/// @tparam Bundle The shared_resources to hold
+/// @tparam Default teardown::leak to leak every resource, or teardown::destroy to follow teardown_policy per type
+/// @note Intended for static and global bundles. Resources are torn down in reverse order of resource_list: a leaked
+///       resource runs its flush_hook, any other resource is destroyed. The bundle itself is never destroyed.
+///
+template <shared_resources_concept Bundle, teardown Default = teardown::destroy>
+class process_lifetime
+{
+public:
+    /// @brief The effective type_list of the bundle
+    using resource_list = typename Bundle::resource_list;
+
+    ///
+    /// @brief Constructs the bundle with the given arguments
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the bundle with
+    ///
+    template <typename... Args>
+        requires std::constructible_from<Bundle, Args...>
+    explicit process_lifetime(Args &&...args)
+    {
+        ::new (static_cast<void *>(storage_)) Bundle(std::forward<Args>(args)...);
+    }
+
+    process_lifetime(process_lifetime const &)            = delete;
+    process_lifetime &operator=(process_lifetime const &) = delete;
+
+    ///
+    /// @brief Tears the bundle down according to the teardown policies
+    ///
+    ~process_lifetime()
+    {
+        tear_down(std::make_index_sequence<internals::type_list_size<resource_list>::value>{});
+    }
+
+    ///
+    /// @brief Checks if a resource of type U is leaked at teardown
+    /// @tparam U The type of the resource
+    /// @return true if the destructor of the resource is skipped
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    static constexpr bool leaks() noexcept
+    {
+        return Default == teardown::leak || teardown_policy<U>::value == teardown::leak;
+    }
+
+    ///
+    /// @brief Gets a reference to the resource of type U
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    U &get() noexcept
+    {
+        return bundle().template get<U>();
+    }
+
+    ///
+    /// @brief Gets a const reference to the resource of type U
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    U const &get() const noexcept
+    {
+        return bundle().template get<U>();
+    }
+
+    ///
+    /// @brief Gets the bundle
+    /// @return A reference to the bundle
+    ///
+    Bundle &bundle() noexcept
+    {
+        return *std::launder(reinterpret_cast<Bundle *>(storage_));
+    }
+
+    ///
+    /// @brief Gets the bundle
+    /// @return A const reference to the bundle
+    ///
+    Bundle const &bundle() const noexcept
+    {
+        return *std::launder(reinterpret_cast<Bundle const *>(storage_));
+    }
+
+private:
+    ///
+    /// @brief Tears the resources down, last type first
+    /// @tparam Indices The indices of the types in resource_list
+    ///
+    template <std::size_t... Indices>
+    void tear_down(std::index_sequence<Indices...>) noexcept
+    {
+        constexpr std::size_t size = sizeof...(Indices);
+        (tear_down<typename internals::type_at<size - 1 - Indices, resource_list>::type>(), ...);
+    }
+
+    ///
+    /// @brief Runs the flush_hook of a leaked resource or destroys any other resource
+    /// @tparam U The type of the resource
+    ///
+    template <typename U>
+    void tear_down() noexcept
+    {
+        if constexpr (leaks<U>())
+        {
+            flush_hook<U>::run(get<U>());
+        }
+        else
+        {
+            std::destroy_at(std::addressof(get<U>()));
+        }
+    }
+
+    /// @brief The storage of the bundle, which is never destroyed as a whole
+    alignas(Bundle) std::byte storage_[sizeof(Bundle)];
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_FAST_EXIT_HPP
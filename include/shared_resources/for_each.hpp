@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file for_each.hpp
+///
+
+#ifndef SHARED_RESOURCES_FOR_EACH_HPP
+#define SHARED_RESOURCES_FOR_EACH_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+
+///
+/// @brief Relative cost of visiting a resource of type T in par_for_each
+/// @tparam T The resource type
+/// @note Specialize this trait to balance expensive resources across worker threads
+///
+template <typename T>
+struct cost_hint
+    : public std::integral_constant<std::size_t, 1>
+{
+};
+
+namespace internals
+{
+
+///
+/// @brief Calls fn on every resource in types, in order
+/// @tparam Bundle The type of the bundle
+/// @tparam Fn The type of the function
+/// @tparam Types The effective types of the bundle
+/// @param bundle The bundle to visit
+/// @param fn The function to call
+///
+template <typename Bundle, typename Fn, typename... Types>
+constexpr void for_each(Bundle &bundle, Fn &fn, type_list<Types...>)
+{
+    (fn(bundle.template get<Types>()), ...);
+}
+
+///
+/// @brief A type-erased visit of a single member
+/// @tparam Bundle The type of the bundle
+/// @tparam Fn The type of the function
+///
+template <typename Bundle, typename Fn>
+struct visit_task
+{
+    /// @brief Calls the function on the member
+    void (*invoke)(Bundle &, Fn &);
+
+    /// @brief The cost hint of the member
+    std::size_t cost;
+};
+
+///
+/// @brief Calls fn on the resource of type T
+/// @tparam Bundle The type of the bundle
+/// @tparam Fn The type of the function
+/// @tparam T The type of the resource
+///
+template <typename Bundle, typename Fn, typename T>
+void visit_one(Bundle &bundle, Fn &fn)
+{
+    fn(bundle.template get<T>());
+}
+
+///
+/// @brief Creates one visit_task per effective type
+/// @tparam Bundle The type of the bundle
+/// @tparam Fn The type of the function
+/// @tparam Types The effective types of the bundle
+/// @return An array of visit_tasks in type_list order
+///
+template <typename Bundle, typename Fn, typename... Types>
+constexpr std::array<visit_task<Bundle, Fn>, sizeof...(Types)> make_visit_tasks(type_list<Types...>) noexcept
+{
+    return { { visit_task<Bundle, Fn>{ &visit_one<Bundle, Fn, Types>, cost_hint<Types>::value }... } };
+}
+
+///
+/// @brief Calls run_group(group) for every group in [0, groups), each on its own thread
+/// @tparam Fn The type of the function
+/// @param groups The number of groups; group 0 runs on the calling thread
+/// @param run_group The function to call for each group
+/// @note The first exception thrown by run_group is rethrown after all groups have finished.
+///       Groups whose thread cannot be spawned run on the calling thread.
+///
+template <typename Fn>
+void parallel_invoke(std::size_t groups, Fn &run_group)
+{
+    std::vector<std::exception_ptr> errors(groups);
+    auto guarded = [&](std::size_t group) noexcept {
+        try
+        {
+            run_group(group);
+        }
+        catch (...)
+        {
+            errors[group] = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(groups > 0 ? groups - 1 : 0);
+        for (std::size_t group = 1; group < groups; ++group)
+        {
+            try
+            {
+                workers.emplace_back(guarded, group);
+            }
+            catch (...)
+            {
+                guarded(group);
+            }
+        }
+        if (groups > 0)
+        {
+            guarded(0);
+        }
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    for (auto const &error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace internals
+
+///
+/// @brief Calls fn on every resource of a bundle sequentially
+/// @tparam Bundle The type of the bundle, possibly const
+/// @tparam Fn The type of the function
+/// @param bundle The bundle to visit
+/// @param fn The function to call with a reference to each resource
+///
+template <typename Bundle, typename Fn>
+    requires bundle_concept<Bundle>
+constexpr void for_each(Bundle &bundle, Fn &&fn)
+{
+    internals::for_each(bundle, fn, typename std::remove_const_t<Bundle>::resource_list{});
+}
+
+///
+/// @brief Calls fn on every resource of a bundle in parallel
+/// @tparam Bundle The type of the bundle, possibly const
+/// @tparam Fn The type of the function
+/// @param bundle The bundle to visit
+/// @param fn The function to call with a reference to each resource; called concurrently
+/// @param max_threads The maximum number of threads to use, including the calling thread
+/// @note Members are grouped by cost_hint so that each thread receives a similar load.
+///       The first exception thrown by fn is rethrown after all groups have finished.
+///
+template <typename Bundle, typename Fn>
+    requires bundle_concept<Bundle>
+void par_for_each(Bundle &bundle, Fn &&fn, std::size_t max_threads = std::thread::hardware_concurrency())
+{
+    using fn_type              = std::remove_reference_t<Fn>;
+    constexpr auto tasks       = internals::make_visit_tasks<Bundle, fn_type>(typename std::remove_const_t<Bundle>::resource_list{});
+    constexpr std::size_t size = tasks.size();
+
+    std::size_t const groups = std::clamp<std::size_t>(max_threads, 1, std::max<std::size_t>(size, 1));
+    if (groups <= 1)
+    {
+        for_each(bundle, fn);
+        return;
+    }
+
+    // Longest processing time first: assign the most expensive members to the least loaded group
+    std::array<std::size_t, size> order;
+    std::iota(order.begin(), order.end(), std::size_t{ 0 });
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return tasks[a].cost > tasks[b].cost; });
+
+    std::array<std::size_t, size> load{};
+    std::array<std::size_t, size> group_of{};
+    for (std::size_t index : order)
+    {
+        std::size_t const group = static_cast<std::size_t>(std::min_element(load.begin(), load.begin() + groups) - load.begin());
+        group_of[index]         = group;
+        load[group] += tasks[index].cost;
+    }
+
+    auto run_group = [&](std::size_t group) {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (group_of[i] == group)
+            {
+                tasks[i].invoke(bundle, fn);
+            }
+        }
+    };
+    internals::parallel_invoke(groups, run_group);
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_FOR_EACH_HPP
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file kernel.hpp
+///
+
+#ifndef SHARED_RESOURCES_KERNEL_HPP
+#define SHARED_RESOURCES_KERNEL_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <initializer_list>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Instruction set levels that kernel variants can be compiled for, in increasing order
+///
+enum class isa
+{
+    /// @brief No requirement beyond the compilation target
+    baseline,
+
+    /// @brief x86 SSE2
+    sse2,
+
+    /// @brief x86 AVX2
+    avx2,
+
+    /// @brief x86 AVX-512 Foundation
+    avx512,
+};
+
+namespace internals
+{
+
+///
+/// @brief Queries the highest instruction set level the host CPU and OS support
+/// @return The level
+///
+inline isa query_isa() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return isa::avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return isa::sse2;
+    }
+#endif
+    return isa::baseline;
+}
+
+}  // namespace internals
+
+///
+/// @brief Gets the highest instruction set level the host supports, queried once per process
+/// @return The level
+///
+inline isa host_isa() noexcept
+{
+    static isa const level = internals::query_isa();
+    return level;
+}
+
+///
+/// @brief A variant of a kernel function table compiled for an instruction set level
+/// @tparam Table The type of the function table
+///
+template <typename Table>
+struct kernel_variant
+{
+    /// @brief The instruction set level the variant requires
+    isa level;
+
+    /// @brief The function table
+    Table table;
+};
+
+///
+/// @brief A slot holding the best variant of a function table for the host CPU, selected once at construction
+/// @tparam Table The type of the function table, e.g. a struct of function pointers
+/// @note get<Table>() on a shared_resources holding the slot returns the selected table, so calls pay no dispatch beyond
+///       what Table itself does. Variants are usually compiled with target attributes or in separate translation
+///       units built with the matching flags.
+///
+template <typename Table>
+class kernel
+{
+public:
+    /// @brief The interface the slot provides to get<Table>()
+    using interface_type = Table;
+
+    /// @brief The type the slot returns from get()
+    using implementation_type = Table;
+
+    ///
+    /// @brief Selects the variant with the highest level the host supports
+    /// @param baseline The table that runs everywhere
+    /// @param variants The tables for higher instruction set levels
+    /// @param host The level of the host; host_isa() unless overridden, e.g. to test a lower level
+    ///
+    kernel(Table baseline, std::initializer_list<kernel_variant<Table>> variants, isa host = host_isa())
+        : table_(std::move(baseline))
+    {
+        for (auto const &variant : variants)
+        {
+            if (variant.level <= host && variant.level >= level_)
+            {
+                table_ = variant.table;
+                level_ = variant.level;
+            }
+        }
+    }
+
+    ///
+    /// @brief Gets the selected function table
+    /// @return A const reference to the table
+    ///
+    Table const &get() const noexcept
+    {
+        return table_;
+    }
+
+    ///
+    /// @brief Gets the instruction set level of the selected variant
+    /// @return The level
+    ///
+    isa level() const noexcept
+    {
+        return level_;
+    }
+
+private:
+    /// @brief The selected function table
+    Table table_;
+
+    /// @brief The instruction set level of the selected variant
+    isa level_ = isa::baseline;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_KERNEL_HPP
@@ -0,0 +1,306 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file one_of.hpp
+///
+
+#ifndef SHARED_RESOURCES_ONE_OF_HPP
+#define SHARED_RESOURCES_ONE_OF_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace srs
+{
+
+/// @brief The number of alternatives up to which one_of dispatches through a branch chain instead of a jump table
+inline constexpr std::size_t one_of_branch_limit = 4;
+
+namespace internals
+{
+
+///
+/// @brief Calls fn on alternative Index of a variant
+/// @tparam Index The index of the alternative
+/// @tparam R The return type
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @param alternatives The variant, which must hold alternative Index
+/// @param fn The function
+/// @return The result of fn
+///
+template <std::size_t Index, typename R, typename Variant, typename Fn>
+constexpr R invoke_alternative(Variant &alternatives, Fn &fn)
+{
+    return std::invoke(fn, *std::get_if<Index>(&alternatives));
+}
+
+///
+/// @brief Calls fn on the held alternative of a variant by testing the indices in order
+/// @tparam Index The first index to test
+/// @tparam R The return type
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @param alternatives The variant
+/// @param fn The function
+/// @return The result of fn
+///
+template <std::size_t Index, typename R, typename Variant, typename Fn>
+constexpr R branch_dispatch(Variant &alternatives, Fn &fn)
+{
+    if constexpr (Index + 1 == std::variant_size_v<std::remove_const_t<Variant>>)
+    {
+        return invoke_alternative<Index, R>(alternatives, fn);
+    }
+    else
+    {
+        if (alternatives.index() == Index)
+        {
+            return invoke_alternative<Index, R>(alternatives, fn);
+        }
+        return branch_dispatch<Index + 1, R>(alternatives, fn);
+    }
+}
+
+///
+/// @brief The jump table calling a function on each alternative of a variant
+/// @tparam R The return type
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @tparam Indices The indices of the alternatives
+///
+template <typename R, typename Variant, typename Fn, std::size_t... Indices>
+inline constexpr R (*dispatch_table[])(Variant &, Fn &) = { &invoke_alternative<Indices, R, Variant, Fn>... };
+
+///
+/// @brief Calls fn on the held alternative of a variant through a jump table
+/// @tparam R The return type
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @tparam Indices The indices of the alternatives
+/// @param alternatives The variant
+/// @param fn The function
+/// @return The result of fn
+///
+template <typename R, typename Variant, typename Fn, std::size_t... Indices>
+constexpr R table_dispatch(Variant &alternatives, Fn &fn, std::index_sequence<Indices...>)
+{
+    return dispatch_table<R, Variant, Fn, Indices...>[alternatives.index()](alternatives, fn);
+}
+
+///
+/// @brief Checks if fn returns R for every alternative of a variant
+/// @tparam R The return type for the first alternative
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @tparam Indices The indices of the alternatives
+/// @return true if every alternative gives R
+///
+template <typename R, typename Variant, typename Fn, std::size_t... Indices>
+consteval bool same_visit_result(std::index_sequence<Indices...>)
+{
+    return (std::is_same_v<std::invoke_result_t<Fn &, decltype(*std::get_if<Indices>(std::declval<Variant *>()))>, R> && ...);
+}
+
+///
+/// @brief Calls fn on the held alternative of a variant
+/// @tparam Variant The type of the variant
+/// @tparam Fn The type of the function
+/// @param alternatives The variant
+/// @param fn The function, which must return the same type for every alternative, checked at compile time
+/// @return The result of fn
+/// @throws std::bad_variant_access if the variant is valueless
+///
+template <typename Variant, typename Fn>
+constexpr decltype(auto) dispatch(Variant &alternatives, Fn &fn)
+{
+    using R = std::invoke_result_t<Fn &, decltype(*std::get_if<0>(std::declval<Variant *>()))>;
+    constexpr std::size_t size = std::variant_size_v<std::remove_const_t<Variant>>;
+    static_assert(same_visit_result<R, Variant, Fn>(std::make_index_sequence<size>{}),
+                  "the function must return the same type for every alternative");
+
+    if (alternatives.valueless_by_exception())
+    {
+        throw std::bad_variant_access();
+    }
+    if constexpr (size <= one_of_branch_limit)
+    {
+        return branch_dispatch<0, R>(alternatives, fn);
+    }
+    else
+    {
+        return table_dispatch<R>(alternatives, fn, std::make_index_sequence<size>{});
+    }
+}
+
+}  // namespace internals
+
+///
+/// @brief A slot holding one of a closed set of implementations, dispatched without virtual calls
+/// @tparam Impls The implementation types
+/// @note visit() dispatches through a branch chain for up to one_of_branch_limit alternatives and through a jump table
+///       beyond, so calls inside the visitor are made on the concrete type and can be inlined. Visit once around a
+///       loop, or use visit_each, to run a batch against one concrete type.
+///
+template <typename... Impls>
+    requires(sizeof...(Impls) > 0) && internals::no_duplicates<Impls...>
+class one_of
+{
+public:
+    /// @brief The type of the underlying variant
+    using variant_type = std::variant<Impls...>;
+
+    ///
+    /// @brief Constructs the slot with one of the implementations
+    /// @tparam Impl The type of the implementation
+    /// @param impl The implementation
+    ///
+    template <typename Impl>
+        requires internals::contains_concept<std::remove_cvref_t<Impl>, type_list<Impls...>>
+    constexpr explicit one_of(Impl &&impl)
+        : alternatives_(std::forward<Impl>(impl))
+    {
+    }
+
+    ///
+    /// @brief Constructs an implementation in place
+    /// @tparam Impl The type of the implementation
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the implementation with
+    ///
+    template <typename Impl, typename... Args>
+        requires internals::contains_concept<Impl, type_list<Impls...>> && std::constructible_from<Impl, Args...>
+    constexpr explicit one_of(std::in_place_type_t<Impl> tag, Args &&...args)
+        : alternatives_(tag, std::forward<Args>(args)...)
+    {
+    }
+
+    ///
+    /// @brief Calls fn on the held implementation
+    /// @tparam Fn The type of the function
+    /// @param fn The function, which must return the same type for every implementation
+    /// @return The result of fn
+    ///
+    template <typename Fn>
+        requires(std::invocable<Fn &, Impls &> && ...)
+    constexpr decltype(auto) visit(Fn &&fn)
+    {
+        return internals::dispatch(alternatives_, fn);
+    }
+
+    ///
+    /// @brief Calls fn on the held implementation
+    /// @tparam Fn The type of the function
+    /// @param fn The function, which must return the same type for every implementation
+    /// @return The result of fn
+    ///
+    template <typename Fn>
+        requires(std::invocable<Fn &, Impls const &> && ...)
+    constexpr decltype(auto) visit(Fn &&fn) const
+    {
+        return internals::dispatch(alternatives_, fn);
+    }
+
+    ///
+    /// @brief Replaces the implementation by one constructed in place
+    /// @tparam Impl The type of the implementation
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the implementation with
+    /// @return A reference to the new implementation
+    ///
+    template <typename Impl, typename... Args>
+        requires internals::contains_concept<Impl, type_list<Impls...>> && std::constructible_from<Impl, Args...>
+    constexpr Impl &emplace(Args &&...args)
+    {
+        return alternatives_.template emplace<Impl>(std::forward<Args>(args)...);
+    }
+
+    ///
+    /// @brief Gets the index of the held implementation in Impls
+    /// @return The index
+    ///
+    constexpr std::size_t index() const noexcept
+    {
+        return alternatives_.index();
+    }
+
+    ///
+    /// @brief Checks if the held implementation is of type Impl
+    /// @tparam Impl The type of the implementation
+    /// @return true if the slot holds an Impl
+    ///
+    template <typename Impl>
+        requires internals::contains_concept<Impl, type_list<Impls...>>
+    constexpr bool holds() const noexcept
+    {
+        return std::holds_alternative<Impl>(alternatives_);
+    }
+
+    ///
+    /// @brief Gets the underlying variant
+    /// @return A const reference to the variant
+    ///
+    constexpr variant_type const &variant() const noexcept
+    {
+        return alternatives_;
+    }
+
+private:
+    /// @brief The held implementation
+    variant_type alternatives_;
+};
+
+///
+/// @brief Calls fn on the implementation held by the one_of slot of type T in a bundle
+/// @tparam T The type of the one_of slot
+/// @tparam Bundle The type of the bundle
+/// @tparam Fn The type of the function
+/// @param bundle The bundle
+/// @param fn The function
+/// @return The result of fn
+///
+template <typename T, typename Bundle, typename Fn>
+    requires bundle_concept<Bundle>
+constexpr decltype(auto) visit(Bundle &bundle, Fn &&fn)
+{
+    return bundle.template get<T>().visit(std::forward<Fn>(fn));
+}
+
+///
+/// @brief Calls fn on the implementation held by the one_of slot of type T and each element of a range, dispatching once
+/// @tparam T The type of the one_of slot
+/// @tparam Bundle The type of the bundle
+/// @tparam Range The type of the range
+/// @tparam Fn The type of the function
+/// @param bundle The bundle
+/// @param range The range
+/// @param fn The function, called as fn(implementation, element) for every element
+///
+template <typename T, typename Bundle, std::ranges::range Range, typename Fn>
+    requires bundle_concept<Bundle>
+constexpr void visit_each(Bundle &bundle, Range &&range, Fn &&fn)
+{
+    bundle.template get<T>().visit([&](auto &impl) {
+        for (auto &&element : range)
+        {
+            fn(impl, std::forward<decltype(element)>(element));
+        }
+    });
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_ONE_OF_HPP
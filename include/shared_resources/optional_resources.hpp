@@ -0,0 +1,516 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file optional_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_OPTIONAL_RESOURCES_HPP
+#define SHARED_RESOURCES_OPTIONAL_RESOURCES_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Marks a resource of an optional_resources as optional
+/// @tparam T The type of the resource
+///
+template <typename T>
+struct maybe
+{
+    /// @brief The type of the resource
+    using type = T;
+};
+
+namespace internals
+{
+
+///
+/// @brief Trait to check if a type is a maybe
+///
+template <typename T>
+struct is_maybe
+    : public std::false_type
+{
+};
+
+template <typename T>
+struct is_maybe<maybe<T>>
+    : public std::true_type
+{
+};
+
+///
+/// @brief Gets a type_list of the type marked by a maybe, or an empty type_list for any other type
+///
+template <typename T>
+struct unwrap_maybe
+{
+    using type = type_list<>;
+};
+
+template <typename T>
+struct unwrap_maybe<maybe<T>>
+{
+    using type = type_list<T>;
+};
+
+///
+/// @brief Gets the types of a type_list that are not marked with maybe
+///
+template <type_list_concept List>
+struct required_types;
+
+template <>
+struct required_types<type_list<>>
+{
+    using type = type_list<>;
+};
+
+template <typename Head, typename... Tail>
+struct required_types<type_list<Head, Tail...>>
+{
+    using type = typename concat<std::conditional_t<is_maybe<Head>::value, type_list<>, type_list<Head>>,
+                                 typename required_types<type_list<Tail...>>::type>::type;
+};
+
+///
+/// @brief Gets the types of a type_list that are marked with maybe, without the marker
+///
+template <type_list_concept List>
+struct optional_types;
+
+template <>
+struct optional_types<type_list<>>
+{
+    using type = type_list<>;
+};
+
+template <typename Head, typename... Tail>
+struct optional_types<type_list<Head, Tail...>>
+{
+    using type = typename concat<typename unwrap_maybe<Head>::type, typename optional_types<type_list<Tail...>>::type>::type;
+};
+
+///
+/// @brief Checks if every type of a type_list is nothrow move constructible
+///
+template <type_list_concept List>
+struct nothrow_move_constructible_all;
+
+template <typename... Types>
+struct nothrow_move_constructible_all<type_list<Types...>>
+    : public std::bool_constant<(std::is_nothrow_move_constructible_v<Types> && ...)>
+{
+};
+
+///
+/// @brief Uninitialized storage for an optional resource, whose presence is tracked by its bundle
+/// @tparam T The type of the resource
+///
+template <typename T>
+struct optional_slot
+{
+    alignas(T) std::byte data[sizeof(T)];
+};
+
+///
+/// @brief The uninitialized storage of all optional resources
+///
+template <type_list_concept List>
+struct optional_slots;
+
+template <typename... Types>
+struct optional_slots<type_list<Types...>>
+{
+    using type = std::tuple<optional_slot<Types>...>;
+};
+
+}  // namespace internals
+
+///
+/// @brief Provides shared resources some of which are optional, with their presence packed into one bitmask
+/// @tparam List A type_list of resource types; types wrapped in maybe are optional
+/// @note Optional resources are stored inline without a flag each, so checking the presence of several of them is one
+///       masked compare. resource_list holds only the required types, which get<U>() and bundle algorithms use;
+///       optional resources are reached through has() and try_get().
+///
+template <type_list_concept List>
+class optional_resources
+{
+private:
+    /// @brief The list of required types
+    using required_list = typename internals::required_types<List>::type;
+
+    /// @brief The required resources
+    using resources_type = shared_resources<required_list>;
+
+public:
+    /// @brief The effective type_list of the required resources
+    using resource_list = required_list;
+
+    /// @brief The type_list of the optional resources
+    using optional_list = typename internals::optional_types<List>::type;
+
+    static_assert(internals::type_list_size<optional_list>::value <= 64, "optional_resources supports up to 64 optional types");
+    static_assert(internals::type_list_size<typename internals::remove_list<optional_list, required_list>::type>::value
+                      == internals::type_list_size<optional_list>::value,
+                  "a type cannot be both required and optional");
+
+    ///
+    /// @brief Constructs optional_resources with the given arguments
+    /// @tparam Args The types of the arguments
+    /// @param args The required resources, followed or interleaved by any optional resources to set
+    ///
+    template <typename... Args>
+        requires internals::contains_all_concept<required_list, type_list<Args...>>
+    explicit optional_resources(Args const &...args)
+        : required_(args...)
+    {
+        try
+        {
+            (emplace_argument<Args>(args), ...);
+        }
+        catch (...)
+        {
+            clear(optional_indices{});
+            throw;
+        }
+    }
+
+    ///
+    /// @brief Copy constructor
+    /// @param other The optional_resources to copy
+    ///
+    optional_resources(optional_resources const &other)
+        : required_(other.required_)
+    {
+        try
+        {
+            copy_from(other, optional_indices{});
+        }
+        catch (...)
+        {
+            clear(optional_indices{});
+            throw;
+        }
+    }
+
+    ///
+    /// @brief Move constructor; the optional resources of other are moved from but stay present
+    /// @note noexcept if moving every resource is
+    /// @param other The optional_resources to move
+    ///
+    optional_resources(optional_resources &&other) noexcept(nothrow_move)
+        : required_(std::move(other.required_))
+    {
+        if constexpr (nothrow_move)
+        {
+            move_from(other, optional_indices{});
+        }
+        else
+        {
+            try
+            {
+                move_from(other, optional_indices{});
+            }
+            catch (...)
+            {
+                clear(optional_indices{});
+                throw;
+            }
+        }
+    }
+
+    ///
+    /// @brief Copy assignment operator
+    /// @param other The optional_resources to copy
+    /// @return This optional_resources
+    ///
+    optional_resources &operator=(optional_resources const &other)
+    {
+        if (this != std::addressof(other))
+        {
+            resources_type required(other.required_);
+            clear(optional_indices{});
+            replace_required(std::move(required));
+            copy_from(other, optional_indices{});
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Move assignment operator
+    /// @param other The optional_resources to move
+    /// @return This optional_resources
+    ///
+    optional_resources &operator=(optional_resources &&other) noexcept(nothrow_move)
+    {
+        if (this != std::addressof(other))
+        {
+            clear(optional_indices{});
+            replace_required(std::move(other.required_));
+            move_from(other, optional_indices{});
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Destroys the present optional resources
+    ///
+    ~optional_resources()
+    {
+        clear(optional_indices{});
+    }
+
+    ///
+    /// @brief Gets a reference to the required resource of type U
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, required_list>
+    U &get() noexcept
+    {
+        return required_.template get<U>();
+    }
+
+    ///
+    /// @brief Gets a const reference to the required resource of type U
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, required_list>
+    U const &get() const noexcept
+    {
+        return required_.template get<U>();
+    }
+
+    ///
+    /// @brief Checks if all of the given optional resources are present
+    /// @tparam Us The types of the optional resources
+    /// @return true if every resource of Us is present
+    ///
+    template <typename... Us>
+        requires(sizeof...(Us) > 0) && internals::contains_all_concept<type_list<Us...>, optional_list>
+    bool has() const noexcept
+    {
+        constexpr std::uint64_t mask = (bit<Us>() | ...);
+        return (present_ & mask) == mask;
+    }
+
+    ///
+    /// @brief Gets a pointer to the optional resource of type U
+    /// @tparam U The type of the resource
+    /// @return A pointer to the resource, or nullptr if it is absent
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, optional_list>
+    U *try_get() noexcept
+    {
+        return has<U>() ? slot<U>() : nullptr;
+    }
+
+    ///
+    /// @brief Gets a const pointer to the optional resource of type U
+    /// @tparam U The type of the resource
+    /// @return A const pointer to the resource, or nullptr if it is absent
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, optional_list>
+    U const *try_get() const noexcept
+    {
+        return has<U>() ? slot<U>() : nullptr;
+    }
+
+    ///
+    /// @brief Constructs the optional resource of type U, replacing any present one
+    /// @tparam U The type of the resource
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the resource with
+    /// @return A reference to the resource
+    ///
+    template <typename U, typename... Args>
+        requires internals::contains_concept<U, optional_list> && std::constructible_from<U, Args...>
+    U &emplace(Args &&...args)
+    {
+        reset<U>();
+        U *const created = ::new (static_cast<void *>(slot<U>())) U(std::forward<Args>(args)...);
+        present_ |= bit<U>();
+        return *created;
+    }
+
+    ///
+    /// @brief Destroys the optional resource of type U if it is present
+    /// @tparam U The type of the resource
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, optional_list>
+    void reset() noexcept
+    {
+        if (has<U>())
+        {
+            present_ &= ~bit<U>();
+            std::destroy_at(slot<U>());
+        }
+    }
+
+    ///
+    /// @brief Gets the presence bitmask
+    /// @return The bitmask, with bit i set if the i-th type of optional_list is present
+    ///
+    std::uint64_t presence() const noexcept
+    {
+        return present_;
+    }
+
+private:
+    /// @brief The indices of the optional types
+    using optional_indices = std::make_index_sequence<internals::type_list_size<optional_list>::value>;
+
+    /// @brief Whether moving an optional_resources cannot throw
+    static constexpr bool nothrow_move = std::is_nothrow_move_constructible_v<resources_type>
+                                      && internals::nothrow_move_constructible_all<optional_list>::value;
+
+    ///
+    /// @brief Gets the presence bit of the optional type U
+    /// @tparam U The optional type
+    /// @return The bit
+    ///
+    template <typename U>
+    static constexpr std::uint64_t bit() noexcept
+    {
+        return std::uint64_t{ 1 } << internals::index_of<U, optional_list>::value;
+    }
+
+    ///
+    /// @brief Gets the storage of the optional type U
+    /// @tparam U The optional type
+    /// @return A pointer to the storage, which holds a U only if it is present
+    ///
+    template <typename U>
+    U *slot() noexcept
+    {
+        return std::launder(reinterpret_cast<U *>(std::get<internals::index_of<U, optional_list>::value>(slots_).data));
+    }
+
+    ///
+    /// @brief Gets the storage of the optional type U
+    /// @tparam U The optional type
+    /// @return A const pointer to the storage, which holds a U only if it is present
+    ///
+    template <typename U>
+    U const *slot() const noexcept
+    {
+        return std::launder(reinterpret_cast<U const *>(std::get<internals::index_of<U, optional_list>::value>(slots_).data));
+    }
+
+    ///
+    /// @brief Replaces the required resources; shared_resources is not assignable, so they are reconstructed
+    /// @param required The required resources to move in
+    ///
+    void replace_required(resources_type &&required) noexcept
+    {
+        std::destroy_at(std::addressof(required_));
+        std::construct_at(std::addressof(required_), std::move(required));
+    }
+
+    ///
+    /// @brief Sets an optional resource from a constructor argument
+    /// @tparam Arg The type of the argument
+    /// @param arg The argument
+    ///
+    template <typename Arg>
+    void emplace_argument(Arg const &arg)
+    {
+        if constexpr (internals::contains<Arg, optional_list>::value)
+        {
+            emplace<Arg>(arg);
+        }
+    }
+
+    ///
+    /// @brief Copies the present optional resources of another optional_resources
+    /// @param other The optional_resources to copy from
+    ///
+    template <std::size_t... Indices>
+    void copy_from(optional_resources const &other, std::index_sequence<Indices...>)
+    {
+        (copy_one<typename internals::type_at<Indices, optional_list>::type>(other), ...);
+    }
+
+    ///
+    /// @brief Copies the optional resource of type U if it is present in another optional_resources
+    /// @param other The optional_resources to copy from
+    ///
+    template <typename U>
+    void copy_one(optional_resources const &other)
+    {
+        if (U const *const value = other.template try_get<U>())
+        {
+            emplace<U>(*value);
+        }
+    }
+
+    ///
+    /// @brief Moves the present optional resources of another optional_resources
+    /// @param other The optional_resources to move from
+    ///
+    template <std::size_t... Indices>
+    void move_from(optional_resources &other, std::index_sequence<Indices...>)
+    {
+        (move_one<typename internals::type_at<Indices, optional_list>::type>(other), ...);
+    }
+
+    ///
+    /// @brief Moves the optional resource of type U if it is present in another optional_resources
+    /// @param other The optional_resources to move from
+    ///
+    template <typename U>
+    void move_one(optional_resources &other)
+    {
+        if (U *const value = other.template try_get<U>())
+        {
+            emplace<U>(std::move(*value));
+        }
+    }
+
+    ///
+    /// @brief Destroys the present optional resources
+    ///
+    template <std::size_t... Indices>
+    void clear(std::index_sequence<Indices...>) noexcept
+    {
+        (reset<typename internals::type_at<Indices, optional_list>::type>(), ...);
+    }
+
+    /// @brief The required resources
+    resources_type required_;
+
+    /// @brief The storage of the optional resources
+    typename internals::optional_slots<optional_list>::type slots_;
+
+    /// @brief The presence bitmask of the optional resources
+    std::uint64_t present_ = 0;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_OPTIONAL_RESOURCES_HPP
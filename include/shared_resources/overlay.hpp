@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file overlay.hpp
+///
+
+#ifndef SHARED_RESOURCES_OVERLAY_HPP
+#define SHARED_RESOURCES_OVERLAY_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Provides the resources of a base bundle with some of them replaced by references to other objects
+/// @tparam Base The type of the base bundle, possibly const
+/// @tparam Overrides The types of the replaced resources, all provided by Base
+/// @note Neither the base bundle nor the overriding objects are copied; both must outlive the overlay.
+///
+template <bundle_concept Base, typename... Overrides>
+class overlay
+{
+private:
+    /// @brief The list of types provided by the base bundle
+    using base_list = typename std::remove_const_t<Base>::resource_list;
+
+    static_assert(internals::contains_all<type_list<Overrides...>, base_list>::value, "Overrides must be provided by Base");
+
+public:
+    /// @brief The effective type_list of the provided resources, same as for Base
+    using resource_list = base_list;
+
+    ///
+    /// @brief Constructs an overlay on a base bundle
+    /// @param base The base bundle
+    /// @param overrides The objects replacing the resources of their types
+    ///
+    constexpr overlay(Base &base, Overrides &...overrides) noexcept
+        : base_(std::addressof(base)), overrides_(overrides...)
+    {
+    }
+
+    ///
+    /// @brief Gets a reference to the overriding object of type U, or to the resource of type U of the base bundle
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr decltype(auto) get() noexcept
+    {
+        if constexpr (internals::contains<U, type_list<Overrides...>>::value)
+        {
+            return overrides_.template get<U>();
+        }
+        else
+        {
+            return base_->template get<U>();
+        }
+    }
+
+    ///
+    /// @brief Gets a const reference to the overriding object of type U, or to the resource of type U of the base bundle
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr decltype(auto) get() const noexcept
+    {
+        if constexpr (internals::contains<U, type_list<Overrides...>>::value)
+        {
+            return std::as_const(overrides_.template get<U>());
+        }
+        else
+        {
+            return std::as_const(*base_).template get<U>();
+        }
+    }
+
+    ///
+    /// @brief Gets the base bundle
+    /// @return A reference to the base bundle
+    ///
+    constexpr Base &base() const noexcept
+    {
+        return *base_;
+    }
+
+private:
+    /// @brief The base bundle
+    Base *base_;
+
+    /// @brief The overriding objects
+    shared_references<type_list<Overrides...>> overrides_;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_OVERLAY_HPP
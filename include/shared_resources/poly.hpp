@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file poly.hpp
+///
+
+#ifndef SHARED_RESOURCES_POLY_HPP
+#define SHARED_RESOURCES_POLY_HPP
+
+#include <shared_resources/erased.hpp>
+#include <shared_resources/shared_resources.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+/// @brief The default size of the inline buffer of a poly slot
+inline constexpr std::size_t poly_inline_size = 64;
+
+namespace internals
+{
+
+///
+/// @brief Type-erased operations on the buffer of a poly slot
+/// @tparam Base The base type of the implementations
+///
+template <typename Base>
+struct poly_ops
+    : public erased_ops
+{
+    /// @brief Converts the address returned by get to the implementation as Base
+    Base *(*upcast)(void *object) noexcept;
+};
+
+/// @brief The operations of a buffer of Size bytes holding Impl
+template <typename Base, typename Impl, std::size_t Size>
+inline constexpr poly_ops<Base> poly_ops_for{
+    erased_ops_for<Impl, Size>,
+    [](void *object) noexcept -> Base * { return static_cast<Impl *>(object); },
+};
+
+}  // namespace internals
+
+///
+/// @brief A slot holding any copyable implementation of Base, inline when it fits in Size bytes
+/// @tparam Base The base type of the implementations
+/// @tparam Size The size of the inline buffer; larger implementations are allocated on the heap
+/// @note get<Base>() on a shared_resources holding the slot returns the implementation. The address of the
+///       implementation is cached, so an access costs no indirect call and, for inline implementations, no pointer
+///       chase out of the bundle. A moved-from poly is empty.
+///
+template <typename Base, std::size_t Size = poly_inline_size>
+class poly
+{
+public:
+    /// @brief The interface the slot provides to get<Base>()
+    using interface_type = Base;
+
+    /// @brief The type the slot returns from get()
+    using implementation_type = Base;
+
+    ///
+    /// @brief Constructs the slot with a copy or a move of an implementation
+    /// @tparam Impl The type of the implementation
+    /// @param impl The implementation
+    ///
+    template <typename Impl>
+        requires std::derived_from<std::remove_cvref_t<Impl>, Base> && std::copy_constructible<std::remove_cvref_t<Impl>>
+    explicit poly(Impl &&impl)
+    {
+        construct<std::remove_cvref_t<Impl>>(std::forward<Impl>(impl));
+    }
+
+    ///
+    /// @brief Constructs the implementation in place
+    /// @tparam Impl The type of the implementation
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the implementation with
+    ///
+    template <typename Impl, typename... Args>
+        requires std::derived_from<Impl, Base> && std::copy_constructible<Impl> && std::constructible_from<Impl, Args...>
+    explicit poly(std::in_place_type_t<Impl>, Args &&...args)
+    {
+        construct<Impl>(std::forward<Args>(args)...);
+    }
+
+    ///
+    /// @brief Copy constructor
+    /// @param other The slot to copy
+    ///
+    poly(poly const &other)
+        : ops_(other.ops_)
+    {
+        if (ops_ != nullptr)
+        {
+            ops_->copy(buffer_, other.buffer_);
+            base_ = ops_->upcast(ops_->get(buffer_));
+        }
+    }
+
+    ///
+    /// @brief Move constructor
+    /// @param other The slot to move, which is left empty
+    ///
+    poly(poly &&other) noexcept
+        : ops_(std::exchange(other.ops_, nullptr))
+    {
+        if (ops_ != nullptr)
+        {
+            ops_->relocate(buffer_, other.buffer_);
+            base_       = ops_->upcast(ops_->get(buffer_));
+            other.base_ = nullptr;
+        }
+    }
+
+    ///
+    /// @brief Assignment operator
+    /// @param other The slot to copy or move from
+    /// @return This slot
+    ///
+    poly &operator=(poly other) noexcept
+    {
+        reset();
+        if (other.ops_ != nullptr)
+        {
+            ops_ = std::exchange(other.ops_, nullptr);
+            ops_->relocate(buffer_, other.buffer_);
+            base_       = ops_->upcast(ops_->get(buffer_));
+            other.base_ = nullptr;
+        }
+        return *this;
+    }
+
+    ///
+    /// @brief Destroys the implementation
+    ///
+    ~poly()
+    {
+        reset();
+    }
+
+    ///
+    /// @brief Replaces the implementation by one constructed in place
+    /// @tparam Impl The type of the implementation
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the implementation with
+    /// @return A reference to the new implementation
+    ///
+    template <typename Impl, typename... Args>
+        requires std::derived_from<Impl, Base> && std::copy_constructible<Impl> && std::constructible_from<Impl, Args...>
+    Impl &emplace(Args &&...args)
+    {
+        reset();
+        construct<Impl>(std::forward<Args>(args)...);
+        return static_cast<Impl &>(*base_);
+    }
+
+    ///
+    /// @brief Gets the implementation
+    /// @return A reference to the implementation
+    ///
+    Base &get() noexcept
+    {
+        return *base_;
+    }
+
+    ///
+    /// @brief Gets the implementation
+    /// @return A const reference to the implementation
+    ///
+    Base const &get() const noexcept
+    {
+        return *base_;
+    }
+
+    ///
+    /// @brief Checks if the implementation is stored in the inline buffer
+    /// @return true if the implementation is inline, false if it is on the heap or the slot is empty
+    ///
+    bool is_inline() const noexcept
+    {
+        return ops_ != nullptr && ops_->inline_storage;
+    }
+
+private:
+    ///
+    /// @brief Constructs an implementation in the empty slot
+    /// @tparam Impl The type of the implementation
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the implementation with
+    ///
+    template <typename Impl, typename... Args>
+    void construct(Args &&...args)
+    {
+        internals::erased_construct<Impl, Size>(buffer_, std::forward<Args>(args)...);
+        ops_  = &internals::poly_ops_for<Base, Impl, Size>;
+        base_ = ops_->upcast(ops_->get(buffer_));
+    }
+
+    ///
+    /// @brief Destroys the implementation, leaving the slot empty
+    ///
+    void reset() noexcept
+    {
+        if (ops_ != nullptr)
+        {
+            ops_->destroy(buffer_);
+            ops_  = nullptr;
+            base_ = nullptr;
+        }
+    }
+
+    /// @brief The inline buffer, holding the implementation or a pointer to it
+    alignas(std::max_align_t) std::byte buffer_[Size < sizeof(void *) ? sizeof(void *) : Size];
+
+    /// @brief The cached address of the implementation
+    Base *base_ = nullptr;
+
+    /// @brief The operations of the implementation, or nullptr if the slot is empty
+    internals::poly_ops<Base> const *ops_ = nullptr;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_POLY_HPP
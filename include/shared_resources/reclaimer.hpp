@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file reclaimer.hpp
+///
+
+#ifndef SHARED_RESOURCES_RECLAIMER_HPP
+#define SHARED_RESOURCES_RECLAIMER_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/epoch.hpp>
+
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace srs
+{
+namespace internals
+{
+
+///
+/// @brief Checks if a type is a std::unique_ptr or std::shared_ptr
+///
+template <typename T>
+struct is_smart_pointer
+    : public std::false_type
+{
+};
+
+template <typename T, typename Deleter>
+struct is_smart_pointer<std::unique_ptr<T, Deleter>>
+    : public std::true_type
+{
+};
+
+template <typename T>
+struct is_smart_pointer<std::shared_ptr<T>>
+    : public std::true_type
+{
+};
+
+}  // namespace internals
+
+///
+/// @brief Destroys retired objects on a background thread so that no latency-sensitive thread runs a heavy destructor
+/// @note The queue holds at most a fixed number of objects and never allocates after construction. When it is full,
+///       retire() waits for the background thread to make room, which bounds the memory held by retired objects.
+///
+class reclaimer
+{
+public:
+    /// @brief The type of a function destroying a retired object
+    using deleter_type = internals::deleter_type;
+
+    ///
+    /// @brief Starts the background thread
+    /// @param capacity The maximum number of objects waiting to be destroyed
+    ///
+    explicit reclaimer(std::size_t capacity = 1024)
+        : queue_(capacity != 0 ? capacity : 1), thread_([this] { run(); })
+    {
+    }
+
+    reclaimer(reclaimer const &)            = delete;
+    reclaimer &operator=(reclaimer const &) = delete;
+
+    ///
+    /// @brief Destroys the waiting objects and stops the background thread
+    ///
+    ~reclaimer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        not_empty_.notify_one();
+        thread_.join();
+    }
+
+    ///
+    /// @brief Hands an object over for destruction
+    /// @param object The object
+    /// @param deleter The function destroying the object
+    ///
+    void retire(void *object, deleter_type deleter)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return size_ < queue_.size(); });
+        queue_[(head_ + size_) % queue_.size()] = { object, deleter };
+        ++size_;
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+
+    ///
+    /// @brief Hands an object over for destruction if the queue has room, without waiting
+    /// @param object The object
+    /// @param deleter The function destroying the object
+    /// @return true if the object was handed over; otherwise the caller still owns it
+    ///
+    bool try_retire(void *object, deleter_type deleter) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (size_ == queue_.size())
+            {
+                return false;
+            }
+            queue_[(head_ + size_) % queue_.size()] = { object, deleter };
+            ++size_;
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    ///
+    /// @brief Hands an owned object over for destruction
+    /// @tparam T The type of the object
+    /// @param object The object
+    ///
+    template <typename T>
+    void retire(std::unique_ptr<T> object)
+    {
+        if (object)
+        {
+            retire(object.get(), [](void *retired) noexcept { delete static_cast<T *>(retired); });
+            object.release();
+        }
+    }
+
+    ///
+    /// @brief Hands a reference over, so that the object is destroyed on the background thread if it is the last one
+    /// @tparam T The type of the object
+    /// @param object The reference
+    ///
+    template <typename T>
+    void retire(std::shared_ptr<T> object)
+    {
+        if (object)
+        {
+            retire(std::make_unique<std::shared_ptr<T>>(std::move(object)));
+        }
+    }
+
+    ///
+    /// @brief Moves an object, such as a whole bundle, to the heap and hands it over for destruction
+    /// @tparam T The type of the object
+    /// @param object The object
+    ///
+    template <typename T>
+        requires(!std::is_lvalue_reference_v<T> && !internals::is_smart_pointer<T>::value && std::move_constructible<T>)
+    void retire(T &&object)
+    {
+        retire(std::make_unique<T>(std::move(object)));
+    }
+
+    ///
+    /// @brief Waits until every object retired so far is destroyed
+    ///
+    void drain()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this] { return size_ == 0 && !busy_; });
+    }
+
+private:
+    /// @brief A retired object with its deleter
+    struct entry
+    {
+        /// @brief The object
+        void *object = nullptr;
+
+        /// @brief The function destroying the object
+        deleter_type deleter = nullptr;
+    };
+
+    ///
+    /// @brief Destroys retired objects until the reclaimer is destroyed and the queue is empty
+    ///
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            not_empty_.wait(lock, [this] { return size_ != 0 || stopping_; });
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            entry const next = queue_[head_];
+            head_            = (head_ + 1) % queue_.size();
+            --size_;
+            busy_ = true;
+            lock.unlock();
+            not_full_.notify_one();
+
+            next.deleter(next.object);
+
+            lock.lock();
+            busy_ = false;
+            if (size_ == 0)
+            {
+                idle_.notify_all();
+            }
+        }
+    }
+
+    /// @brief Guards the queue and the flags
+    std::mutex mutex_;
+
+    /// @brief Wakes the background thread
+    std::condition_variable not_empty_;
+
+    /// @brief Wakes a thread waiting for room in the queue
+    std::condition_variable not_full_;
+
+    /// @brief Wakes threads waiting in drain()
+    std::condition_variable idle_;
+
+    /// @brief The ring buffer of retired objects
+    std::vector<entry> queue_;
+
+    /// @brief The index of the oldest retired object
+    std::size_t head_ = 0;
+
+    /// @brief The number of retired objects waiting
+    std::size_t size_ = 0;
+
+    /// @brief Whether the background thread is destroying an object
+    bool busy_ = false;
+
+    /// @brief Whether the reclaimer is being destroyed
+    bool stopping_ = false;
+
+    /// @brief The background thread, started last
+    std::thread thread_;
+};
+
+///
+/// @brief Replaces the resource of type U in a bundle and hands the previous one to a reclaimer
+/// @tparam U The type of the resource
+/// @tparam Bundle The type of the bundle
+/// @param bundle The bundle
+/// @param value The new resource
+/// @param target The reclaimer destroying the previous resource
+///
+template <typename U, typename Bundle>
+    requires bundle_concept<Bundle> && std::move_constructible<U> && std::is_move_assignable_v<U>
+void replace(Bundle &bundle, U value, reclaimer &target)
+{
+    target.retire(std::exchange(bundle.template get<U>(), std::move(value)));
+}
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_RECLAIMER_HPP
@@ -0,0 +1,365 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file registry.hpp
+///
+
+#ifndef SHARED_RESOURCES_REGISTRY_HPP
+#define SHARED_RESOURCES_REGISTRY_HPP
+
+#include <shared_resources/shared_resources.hpp>
+#include <shared_resources/epoch.hpp>
+#include <shared_resources/reclaimer.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Maps keys, such as tenant IDs, to lazily created bundles with lock-free lookups
+/// @tparam Key The integral type of the keys
+/// @tparam Bundle The type of the bundles
+/// @note Lookups go through a read_guard and never take a lock. Writers publish an open-addressing table with
+///       atomic pointers and retire replaced tables and erased bundles to an epoch_domain, which frees them only
+///       after every read_guard that could still see them is gone.
+///
+template <std::integral Key, typename Bundle>
+class registry
+{
+private:
+    /// @brief A slot of the table that is empty or holds a tombstone
+    struct node_base
+    {
+    };
+
+    /// @brief A slot of the table that holds a bundle
+    struct node : public node_base
+    {
+        /// @brief The key of the bundle
+        Key key;
+
+        /// @brief The bundle
+        Bundle bundle;
+    };
+
+    /// @brief An open-addressing table of nodes with a power of two capacity
+    struct table
+    {
+        ///
+        /// @brief Constructs an empty table
+        /// @param bits The base-2 logarithm of the capacity
+        ///
+        explicit table(unsigned bits)
+            : bits(bits), slots(new std::atomic<node_base *>[std::size_t{ 1 } << bits])
+        {
+            for (std::size_t i = 0; i < capacity(); ++i)
+            {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        ///
+        /// @brief Gets the capacity of the table
+        /// @return The capacity
+        ///
+        std::size_t capacity() const noexcept
+        {
+            return std::size_t{ 1 } << bits;
+        }
+
+        ///
+        /// @brief Gets the first slot to probe for a key
+        /// @param key The key
+        /// @return The index of the slot
+        ///
+        std::size_t home(Key key) const noexcept
+        {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+        }
+
+        /// @brief The base-2 logarithm of the capacity
+        unsigned bits;
+
+        /// @brief The slots
+        std::unique_ptr<std::atomic<node_base *>[]> slots;
+    };
+
+public:
+    /// @brief The type of the function creating the bundle of a key
+    using factory_type = std::function<Bundle(Key)>;
+
+    ///
+    /// @brief Lets the current thread look bundles up; the bundles it returns stay valid until it is destroyed
+    ///
+    class read_guard
+    {
+    public:
+        read_guard(read_guard const &)            = delete;
+        read_guard &operator=(read_guard const &) = delete;
+
+        ///
+        /// @brief Finds the bundle of a key
+        /// @param key The key
+        /// @return A pointer to the bundle, or nullptr if it has not been created
+        ///
+        Bundle *find(Key key) const noexcept
+        {
+            node *const found = registry_->lookup(*registry_->table_.load(std::memory_order_acquire), key);
+            return found != nullptr ? std::addressof(found->bundle) : nullptr;
+        }
+
+        ///
+        /// @brief Gets the bundle of a key, creating it with the factory of the registry if needed
+        /// @param key The key
+        /// @return A reference to the bundle
+        ///
+        Bundle &get(Key key) const
+        {
+            if (Bundle *const found = find(key))
+            {
+                return *found;
+            }
+            return registry_->create(key)->bundle;
+        }
+
+    private:
+        ///
+        /// @brief Enters the read-side critical section
+        /// @param owner The registry to read
+        ///
+        explicit read_guard(registry &owner) noexcept
+            : registry_(std::addressof(owner)), guard_(owner.domain_.enter())
+        {
+        }
+
+        /// @brief The registry
+        registry *registry_;
+
+        /// @brief The read-side critical section
+        internals::epoch_domain::guard guard_;
+
+        friend class registry;
+    };
+
+    ///
+    /// @brief Constructs an empty registry
+    /// @param factory The function creating the bundle of a key on its first lookup through read_guard::get
+    /// @param capacity The number of bundles to make room for
+    ///
+    explicit registry(factory_type factory, std::size_t capacity = 16)
+        : factory_(std::move(factory))
+    {
+        unsigned bits = 1;
+        while ((std::size_t{ 1 } << bits) < capacity * 2)
+        {
+            ++bits;
+        }
+        table_.store(new table(bits));
+    }
+
+    registry(registry const &)            = delete;
+    registry &operator=(registry const &) = delete;
+
+    ///
+    /// @brief Destroys every bundle
+    /// @note No read_guard may be alive
+    ///
+    ~registry()
+    {
+        table *const current = table_.load();
+        for (std::size_t i = 0; i < current->capacity(); ++i)
+        {
+            node_base *const slot = current->slots[i].load(std::memory_order_relaxed);
+            if (slot != nullptr && slot != &tombstone_)
+            {
+                domain_.retire(static_cast<node *>(slot));
+            }
+        }
+        domain_.retire(current);
+    }
+
+    ///
+    /// @brief Hands the destruction of erased bundles, and of every bundle at teardown, to a reclaimer
+    /// @param target The reclaimer, which must outlive the registry
+    /// @note If the queue of the reclaimer is full, bundles are destroyed inline instead of waiting for room
+    ///
+    void defer_destruction(reclaimer &target)
+    {
+        domain_.defer_to(std::addressof(target));
+    }
+
+    ///
+    /// @brief Enters a read-side critical section
+    /// @return The guard of the critical section
+    ///
+    read_guard read() noexcept
+    {
+        return read_guard(*this);
+    }
+
+    ///
+    /// @brief Removes the bundle of a key; it is destroyed once no read_guard can see it
+    /// @param key The key
+    /// @return true if there was a bundle
+    ///
+    bool erase(Key key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        table &current = *table_.load();
+        for (std::size_t i = current.home(key);; i = (i + 1) & (current.capacity() - 1))
+        {
+            node_base *const slot = current.slots[i].load(std::memory_order_relaxed);
+            if (slot == nullptr)
+            {
+                return false;
+            }
+            if (slot != &tombstone_ && static_cast<node *>(slot)->key == key)
+            {
+                current.slots[i].store(&tombstone_, std::memory_order_release);
+                --size_;
+                domain_.retire(static_cast<node *>(slot));
+                return true;
+            }
+        }
+    }
+
+    ///
+    /// @brief Gets the number of bundles
+    /// @return The number of bundles
+    ///
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return size_;
+    }
+
+private:
+    ///
+    /// @brief Finds the node of a key
+    /// @param current The table to search
+    /// @param key The key
+    /// @return The node, or nullptr if there is none
+    ///
+    node *lookup(table const &current, Key key) const noexcept
+    {
+        for (std::size_t i = current.home(key);; i = (i + 1) & (current.capacity() - 1))
+        {
+            node_base *const slot = current.slots[i].load(std::memory_order_acquire);
+            if (slot == nullptr)
+            {
+                return nullptr;
+            }
+            if (slot != &tombstone_ && static_cast<node *>(slot)->key == key)
+            {
+                return static_cast<node *>(slot);
+            }
+        }
+    }
+
+    ///
+    /// @brief Creates and publishes the node of a key unless another thread did first
+    /// @param key The key
+    /// @return The published node
+    ///
+    node *create(Key key)
+    {
+        // Run the factory outside the lock so that creating one tenant does not hold up the others
+        std::unique_ptr<node> created(new node{ {}, key, factory_(key) });
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (node *const found = lookup(*table_.load(), key))
+        {
+            return found;
+        }
+
+        if ((used_ + 1) * 2 > table_.load()->capacity())
+        {
+            grow();
+        }
+
+        table &current = *table_.load();
+        for (std::size_t i = current.home(key);; i = (i + 1) & (current.capacity() - 1))
+        {
+            node_base *const slot = current.slots[i].load(std::memory_order_relaxed);
+            if (slot == nullptr || slot == &tombstone_)
+            {
+                used_ += slot == nullptr ? 1 : 0;
+                ++size_;
+                current.slots[i].store(created.get(), std::memory_order_release);
+                return created.release();
+            }
+        }
+    }
+
+    ///
+    /// @brief Publishes a table without tombstones that has room for twice the bundles and retires the current one
+    /// @note The mutex must be held
+    ///
+    void grow()
+    {
+        table *const old = table_.load();
+        unsigned bits    = old->bits;
+        while ((size_ + 1) * 4 > (std::size_t{ 1 } << bits))
+        {
+            ++bits;
+        }
+
+        auto replacement = std::make_unique<table>(bits);
+        for (std::size_t i = 0; i < old->capacity(); ++i)
+        {
+            node_base *const slot = old->slots[i].load(std::memory_order_relaxed);
+            if (slot != nullptr && slot != &tombstone_)
+            {
+                std::size_t j = replacement->home(static_cast<node *>(slot)->key);
+                while (replacement->slots[j].load(std::memory_order_relaxed) != nullptr)
+                {
+                    j = (j + 1) & (replacement->capacity() - 1);
+                }
+                replacement->slots[j].store(slot, std::memory_order_relaxed);
+            }
+        }
+
+        table_.store(replacement.release());
+        used_ = size_;
+        domain_.retire(old);
+    }
+
+    /// @brief The marker of an erased slot
+    static inline node_base tombstone_{};
+
+    /// @brief The function creating the bundle of a key
+    factory_type factory_;
+
+    /// @brief The published table
+    std::atomic<table *> table_{ nullptr };
+
+    /// @brief Reclaims erased nodes and outgrown tables
+    internals::epoch_domain domain_;
+
+    /// @brief Serializes writers
+    mutable std::mutex mutex_;
+
+    /// @brief The number of bundles
+    std::size_t size_ = 0;
+
+    /// @brief The number of slots that are not empty, including tombstones
+    std::size_t used_ = 0;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_REGISTRY_HPP
@@ -13,12 +13,32 @@
 #ifndef SHARED_RESOURCES_SHARED_RESOURCES_HPP
 #define SHARED_RESOURCES_SHARED_RESOURCES_HPP
 
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 namespace srs
 {
+
+///
+/// @brief Tag to construct a bundle from arguments given exactly in the order of its effective type list
+/// @note Skips matching the arguments against the types, which is useful when constructing many bundles
+///
+struct in_order_t
+{
+    explicit in_order_t() = default;
+};
+
+/// @brief Tag value of in_order_t
+inline constexpr in_order_t in_order{};
+
 namespace internals
 {
 
@@ -146,6 +166,35 @@ concept shared_concept = shared_resources_concept<T> || shared_references_concep
 namespace internals
 {
 
+///
+/// @brief Checks if a bundle, possibly const, provides each type of a type_list through get<T>()
+///
+template <typename Bundle, typename List>
+struct provides_all
+    : public std::false_type
+{
+};
+
+template <typename Bundle, typename... Types>
+struct provides_all<Bundle, type_list<Types...>>
+    : public std::bool_constant<(requires(Bundle &bundle) { bundle.template get<Types>(); } && ...)>
+{
+};
+
+}  // namespace internals
+
+///
+/// @brief Concept to ensure a type, possibly const, provides resources like a shared_resources
+/// @note Such a type exposes its effective type_list as resource_list and each resource through get<T>()
+///
+template <typename T>
+concept bundle_concept = requires { typename std::remove_const_t<T>::resource_list; }
+                         && type_list_concept<typename std::remove_const_t<T>::resource_list>
+                         && internals::provides_all<T, typename std::remove_const_t<T>::resource_list>::value;
+
+namespace internals
+{
+
 ///
 /// @brief Wraps each type in a type_list with std::reference_wrapper
 ///
@@ -192,6 +241,34 @@ struct remove_types<List, Head, Tail...>
     using type = typename remove_types<typename remove_types<List, Head>::type, Tail...>::type;
 };
 
+///
+/// @brief Concatenates two type_lists
+/// @tparam A The first type_list
+/// @tparam B The second type_list
+///
+template <type_list_concept A, type_list_concept B>
+struct concat;
+
+template <typename... A, typename... B>
+struct concat<type_list<A...>, type_list<B...>>
+{
+    using type = type_list<A..., B...>;
+};
+
+///
+/// @brief Removes the types of a type_list from another type_list
+/// @tparam List The original type_list
+/// @tparam Exclude The type_list of types to remove
+///
+template <type_list_concept List, type_list_concept Exclude>
+struct remove_list;
+
+template <type_list_concept List, typename... Exclude>
+struct remove_list<List, type_list<Exclude...>>
+{
+    using type = typename remove_types<List, Exclude...>::type;
+};
+
 ///
 /// @brief Checks if type T is contained in type_list U
 ///
@@ -237,6 +314,56 @@ struct contains_all<type_list<Head, Tail...>, U>
 template <typename T, typename U>
 concept contains_all_concept = type_list_concept<T> && type_list_concept<U> && contains_all<T, U>::value;
 
+///
+/// @brief Gets the index of type T in type_list List
+/// @note T must be contained in List
+///
+template <typename T, type_list_concept List>
+struct index_of;
+
+template <typename T, typename... Tail>
+struct index_of<T, type_list<T, Tail...>>
+    : public std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T, typename Head, typename... Tail>
+struct index_of<T, type_list<Head, Tail...>>
+    : public std::integral_constant<std::size_t, 1 + index_of<T, type_list<Tail...>>::value>
+{
+};
+
+///
+/// @brief Gets the number of types in a type_list
+///
+template <type_list_concept List>
+struct type_list_size;
+
+template <typename... Types>
+struct type_list_size<type_list<Types...>>
+    : public std::integral_constant<std::size_t, sizeof...(Types)>
+{
+};
+
+///
+/// @brief Gets the type at index Index in a type_list
+/// @note Index must be less than the size of List
+///
+template <std::size_t Index, type_list_concept List>
+struct type_at;
+
+template <typename Head, typename... Tail>
+struct type_at<0, type_list<Head, Tail...>>
+{
+    using type = Head;
+};
+
+template <std::size_t Index, typename Head, typename... Tail>
+struct type_at<Index, type_list<Head, Tail...>>
+{
+    using type = typename type_at<Index - 1, type_list<Tail...>>::type;
+};
+
 ///
 /// @brief Base case for getting the first argument of type Target
 /// @tparam Target The type to search for
@@ -305,6 +432,24 @@ public:
     {
     }
 
+    ///
+    /// @brief Constructs storage with the argument in type_list order
+    /// @param head The resource to store
+    ///
+    constexpr storage(in_order_t, T const &head) noexcept
+        : data_(head)
+    {
+    }
+
+    ///
+    /// @brief Constructs storage by moving the argument in type_list order
+    /// @param head The resource to store
+    ///
+    constexpr storage(in_order_t, T &&head) noexcept
+        : data_(std::move(head))
+    {
+    }
+
     ///
     /// @brief Constructs storage by combining two storages
     /// @tparam ListA The type_list of the first storage
@@ -405,6 +550,28 @@ public:
     {
     }
 
+    ///
+    /// @brief Constructs storage with the arguments in type_list order
+    /// @param tag The in_order tag
+    /// @param head The resource of type Head
+    /// @param tail The resources of the remaining types
+    ///
+    constexpr storage(in_order_t tag, Head const &head, Tail const &...tail) noexcept
+        : data_(head), rest_(tag, tail...)
+    {
+    }
+
+    ///
+    /// @brief Constructs storage by moving the arguments in type_list order
+    /// @param tag The in_order tag
+    /// @param head The resource of type Head
+    /// @param tail The resources of the remaining types
+    ///
+    constexpr storage(in_order_t tag, Head &&head, Tail &&...tail) noexcept
+        : data_(std::move(head)), rest_(tag, std::move(tail)...)
+    {
+    }
+
     ///
     /// @brief Constructs storage by combining two storages
     /// @tparam ListA The type_list of the first storage
@@ -505,8 +672,492 @@ struct is_storage<storage<T>>
 template <typename T>
 concept storage_concept = is_storage<T>::value;
 
+///
+/// @brief Gets a compiler-specific signature string that contains the name of T
+/// @tparam T The type to name
+/// @return The signature string
+///
+template <typename T>
+constexpr std::string_view type_signature() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+///
+/// @brief Computes the 64-bit FNV-1a hash of a string
+/// @param str The string to hash
+/// @return The hash of the string
+///
+constexpr std::uint64_t fnv1a(std::string_view str) noexcept
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : str)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
 }  // internals
 
+///
+/// @brief A runtime identifier of a type
+///
+using type_id = std::uint64_t;
+
+///
+/// @brief The type_id of T
+/// @tparam T The type to identify
+/// @note Computed from the name of T at compile time, so it is stable across shared libraries built with the same compiler
+///
+template <typename T>
+inline constexpr type_id type_id_of = internals::fnv1a(internals::type_signature<T>());
+
+namespace internals
+{
+
+///
+/// @brief Parameters of a multiply-shift perfect hash
+///
+struct perfect_hash
+{
+    /// @brief The odd multiplier
+    std::uint64_t multiplier;
+
+    /// @brief The number of bits of the slot index
+    unsigned bits;
+
+    ///
+    /// @brief Computes the slot of a type_id
+    /// @param id The type_id to hash
+    /// @return The slot index
+    ///
+    constexpr std::size_t slot(type_id id) const noexcept
+    {
+        return static_cast<std::size_t>((id * multiplier) >> (64 - bits));
+    }
+};
+
+///
+/// @brief Searches a multiply-shift perfect hash for distinct type_ids at compile time
+/// @tparam N The number of type_ids
+/// @param ids The distinct type_ids to hash
+/// @return The parameters of the first collision-free hash found
+/// @throw std::logic_error if no hash is found, which fails the compilation of a constant evaluation
+/// @note The search is greedy: it starts at the smallest table that fits N ids and takes the first multiplier that
+///       works, growing the table only when 256 multipliers all collide.
+///
+template <std::size_t N>
+constexpr perfect_hash find_perfect_hash(std::array<type_id, N> const &ids)
+{
+    unsigned bits = 1;
+    while ((std::size_t{ 1 } << bits) < N)
+    {
+        ++bits;
+    }
+
+    for (; bits < 64; ++bits)
+    {
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (int attempt = 0; attempt < 256; ++attempt)
+        {
+            // splitmix64 sequence of odd multipliers
+            state += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = state;
+            z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z               = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            perfect_hash const hash{ (z ^ (z >> 31)) | 1, bits };
+
+            bool collision = false;
+            for (std::size_t i = 0; i < N && !collision; ++i)
+            {
+                for (std::size_t j = 0; j < i && !collision; ++j)
+                {
+                    collision = hash.slot(ids[i]) == hash.slot(ids[j]);
+                }
+            }
+            if (!collision)
+            {
+                return hash;
+            }
+        }
+    }
+    throw std::logic_error("no collision-free perfect hash found for the type_ids");
+}
+
+///
+/// @brief Gets the address of the resource of type T in a bundle
+/// @tparam Bundle The type of the bundle, possibly const
+/// @tparam Pointer The type of the returned pointer
+/// @tparam T The type of the resource
+/// @param bundle The bundle
+/// @return The address of the resource
+///
+template <typename Bundle, typename Pointer, typename T>
+Pointer address_of(Bundle &bundle) noexcept
+{
+    return std::addressof(bundle.template get<T>());
+}
+
+///
+/// @brief Compile-time perfect hash table from the type_ids of a type_list to the resources of a bundle
+/// @tparam Bundle The type of the bundle, possibly const
+/// @tparam Pointer The type of the returned pointer
+/// @tparam List The effective type_list of the bundle
+///
+template <typename Bundle, typename Pointer, type_list_concept List>
+class type_lookup;
+
+template <typename Bundle, typename Pointer>
+class type_lookup<Bundle, Pointer, type_list<>>
+{
+public:
+    ///
+    /// @brief Finds nothing in an empty bundle
+    /// @return nullptr
+    ///
+    static Pointer find(Bundle &, type_id) noexcept
+    {
+        return nullptr;
+    }
+};
+
+template <typename Bundle, typename Pointer, typename... Types>
+class type_lookup<Bundle, Pointer, type_list<Types...>>
+{
+public:
+    ///
+    /// @brief Finds the resource with the given type_id
+    /// @param bundle The bundle to search
+    /// @param id The type_id of the resource
+    /// @return The address of the resource, or nullptr if the bundle has no resource with the type_id
+    ///
+    static Pointer find(Bundle &bundle, type_id id) noexcept
+    {
+        entry const &candidate = table_[hash_.slot(id)];
+        return candidate.id == id ? candidate.get(bundle) : nullptr;
+    }
+
+private:
+    /// @brief An entry of the hash table
+    struct entry
+    {
+        /// @brief The type_id of the resource
+        type_id id;
+
+        /// @brief Gets the address of the resource
+        Pointer (*get)(Bundle &) noexcept;
+    };
+
+    /// @brief The type_ids of the types
+    static constexpr std::array<type_id, sizeof...(Types)> ids_{ type_id_of<Types>... };
+
+    /// @brief The perfect hash of the type_ids
+    static constexpr perfect_hash hash_ = find_perfect_hash(ids_);
+
+    ///
+    /// @brief Builds the hash table
+    /// @return The hash table
+    /// @note Empty slots hold the type_id of the first type, which always hashes elsewhere
+    ///
+    static constexpr std::array<entry, std::size_t{ 1 } << hash_.bits> make_table() noexcept
+    {
+        std::array<entry, std::size_t{ 1 } << hash_.bits> table{};
+        for (auto &slot : table)
+        {
+            slot = entry{ ids_[0], nullptr };
+        }
+        std::array<Pointer (*)(Bundle &) noexcept, sizeof...(Types)> const getters{ &address_of<Bundle, Pointer, Types>... };
+        for (std::size_t i = 0; i < sizeof...(Types); ++i)
+        {
+            table[hash_.slot(ids_[i])] = entry{ ids_[i], getters[i] };
+        }
+        return table;
+    }
+
+    /// @brief The hash table
+    static constexpr auto table_ = make_table();
+};
+
+}  // namespace internals
+
+namespace internals
+{
+
+///
+/// @brief A final class deriving from Impl, so that calls through it are devirtualized
+/// @tparam Impl The implementation type
+///
+template <typename Impl>
+class sealed final
+    : public Impl
+{
+public:
+    using Impl::Impl;
+
+    ///
+    /// @brief Constructs the sealed implementation from a copy of an implementation
+    /// @param impl The implementation
+    ///
+    sealed(Impl const &impl)
+        : Impl(impl)
+    {
+    }
+
+    ///
+    /// @brief Constructs the sealed implementation from a moved implementation
+    /// @param impl The implementation
+    ///
+    sealed(Impl &&impl)
+        : Impl(std::move(impl))
+    {
+    }
+};
+
+///
+/// @brief Gets Impl if it is final, or sealed<Impl> otherwise
+///
+template <typename Impl>
+using sealed_t = std::conditional_t<std::is_final_v<Impl>, Impl, sealed<Impl>>;
+
+}  // namespace internals
+
+///
+/// @brief Declares a slot holding an implementation of interface I whose concrete type Impl is fixed at compile time
+/// @tparam I The interface type
+/// @tparam Impl The implementation type, derived from I
+/// @note get<I>() on a shared_resources holding the slot returns the implementation through a final type, so calls
+///       that generic code makes against the interface are resolved statically and can be inlined.
+///
+template <typename I, typename Impl>
+    requires std::derived_from<Impl, I>
+class implements
+{
+public:
+    /// @brief The interface type
+    using interface_type = I;
+
+    /// @brief The implementation type
+    using implementation_type = internals::sealed_t<Impl>;
+
+    ///
+    /// @brief Constructs the implementation with the given arguments
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct Impl with
+    ///
+    template <typename... Args>
+        requires std::constructible_from<Impl, Args...>
+    constexpr explicit implements(Args &&...args)
+        : impl_(std::forward<Args>(args)...)
+    {
+    }
+
+    ///
+    /// @brief Gets the implementation
+    /// @return A reference to the implementation
+    ///
+    constexpr implementation_type &get() noexcept
+    {
+        return impl_;
+    }
+
+    ///
+    /// @brief Gets the implementation
+    /// @return A const reference to the implementation
+    ///
+    constexpr implementation_type const &get() const noexcept
+    {
+        return impl_;
+    }
+
+private:
+    /// @brief The implementation
+    implementation_type impl_;
+};
+
+namespace internals
+{
+
+///
+/// @brief Gets a type_list of T if T is a slot providing interface I, or an empty type_list otherwise
+/// @note A slot provides interface I when its interface_type is I and its get() returns the implementation, like
+///       implements<I, Impl>
+///
+template <typename I, typename T>
+struct implementation_filter
+{
+    using type = type_list<>;
+};
+
+template <typename I, typename T>
+    requires std::same_as<typename T::interface_type, I>
+struct implementation_filter<I, T>
+{
+    using type = type_list<T>;
+};
+
+///
+/// @brief Gets the slots of a type_list providing interface I
+///
+template <typename I, type_list_concept List>
+struct implementations_of;
+
+template <typename I>
+struct implementations_of<I, type_list<>>
+{
+    using type = type_list<>;
+};
+
+template <typename I, typename Head, typename... Tail>
+struct implementations_of<I, type_list<Head, Tail...>>
+{
+    using type = typename concat<typename implementation_filter<I, Head>::type, typename implementations_of<I, type_list<Tail...>>::type>::type;
+};
+
+///
+/// @brief Gets the types of a type_list publicly derived from Base, other than Base itself
+///
+template <typename Base, type_list_concept List>
+struct derived_members;
+
+template <typename Base>
+struct derived_members<Base, type_list<>>
+{
+    using type = type_list<>;
+};
+
+template <typename Base, typename Head, typename... Tail>
+struct derived_members<Base, type_list<Head, Tail...>>
+{
+    using type = typename concat<std::conditional_t<std::derived_from<Head, Base> && !std::same_as<Head, Base>, type_list<Head>, type_list<>>,
+                                 typename derived_members<Base, type_list<Tail...>>::type>::type;
+};
+
+///
+/// @brief Checks if a type_list has a slot providing interface I
+///
+template <typename I, typename List>
+concept implemented_concept = type_list_concept<List> && !contains<I, List>::value
+                           && type_list_size<typename implementations_of<I, List>::type>::value != 0;
+
+///
+/// @brief Checks if Base is reached in a type_list through a member derived from it, rather than stored or implemented
+///
+template <typename Base, typename List>
+concept derived_member_concept = type_list_concept<List> && !contains<Base, List>::value && !implemented_concept<Base, List>
+                              && type_list_size<typename derived_members<Base, List>::type>::value != 0;
+
+/// @brief The cache line size assumed by prefetching
+inline constexpr std::size_t prefetch_line_size = 64;
+
+/// @brief The maximum number of cache lines prefetched per object
+inline constexpr std::size_t prefetch_line_limit = 8;
+
+///
+/// @brief Hints the CPU to load the cache lines of a memory region for reading
+/// @param address The start of the region
+/// @param size The size of the region; at most prefetch_line_limit lines are prefetched
+///
+inline void prefetch_region(void const *address, std::size_t size) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    auto const *const bytes = static_cast<char const *>(address);
+    std::size_t const lines = (size + prefetch_line_size - 1) / prefetch_line_size;
+    for (std::size_t line = 0; line < lines && line < prefetch_line_limit; ++line)
+    {
+        __builtin_prefetch(bytes + line * prefetch_line_size, 0, 3);
+    }
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+///
+/// @brief Trait to get the object a pointer-like resource points to, without calling any user-defined function
+/// @note Raw object pointers, std::unique_ptr and std::shared_ptr are pointer-like; other types point to nothing
+///
+template <typename T>
+struct pointer_like
+{
+    static constexpr void const *address(T const &) noexcept
+    {
+        return nullptr;
+    }
+};
+
+template <typename T>
+    requires std::is_object_v<T> || std::is_void_v<T>
+struct pointer_like<T *>
+{
+    static constexpr T *address(T *resource) noexcept
+    {
+        return resource;
+    }
+};
+
+template <typename T, typename Deleter>
+    requires std::is_pointer_v<typename std::unique_ptr<T, Deleter>::pointer>
+struct pointer_like<std::unique_ptr<T, Deleter>>
+{
+    static constexpr auto address(std::unique_ptr<T, Deleter> const &resource) noexcept
+    {
+        return resource.get();
+    }
+};
+
+template <typename T>
+struct pointer_like<std::shared_ptr<T>>
+{
+    static auto address(std::shared_ptr<T> const &resource) noexcept
+    {
+        return resource.get();
+    }
+};
+
+///
+/// @brief Gets the object a pointer-like resource points to
+/// @tparam T The type of the resource
+/// @param resource The resource
+/// @return The address of the pointed-to object, or nullptr if T is not pointer-like
+///
+template <typename T>
+constexpr auto pointee_of(T const &resource) noexcept
+{
+    return pointer_like<T>::address(resource);
+}
+
+///
+/// @brief Prefetches a resource and, if it is pointer-like, the object it points to
+/// @tparam T The type of the resource
+/// @param resource The resource
+///
+template <typename T>
+void prefetch_resource(T const &resource) noexcept
+{
+    prefetch_region(std::addressof(resource), sizeof(T));
+    auto const pointee = pointee_of(resource);
+    if (pointee != nullptr)
+    {
+        using pointee_type = std::remove_cv_t<std::remove_pointer_t<decltype(pointee)>>;
+        if constexpr (std::is_void_v<pointee_type>)
+        {
+            prefetch_region(pointee, prefetch_line_size);
+        }
+        else
+        {
+            prefetch_region(pointee, sizeof(pointee_type));
+        }
+    }
+}
+
+}  // namespace internals
+
 ///
 /// @brief Provides shared resources of specified types, excluding certain types
 /// @tparam List A type_list of resource types to share
@@ -520,6 +1171,9 @@ private:
     using list = typename internals::remove_types<List, Exclude...>::type;
 
 public:
+    /// @brief The effective type_list of the stored resources
+    using resource_list = list;
+
     ///
     /// @brief Default constructor
     ///
@@ -537,6 +1191,32 @@ public:
     {
     }
 
+    ///
+    /// @brief Constructs shared_resources with arguments in the order of the effective type list
+    /// @tparam Args The types of the arguments, equal to the effective type list
+    /// @param tag The in_order tag
+    /// @param args The arguments to construct the shared resources
+    ///
+    template <typename... Args>
+        requires std::same_as<list, type_list<Args...>>
+    constexpr shared_resources(in_order_t tag, Args const &...args) noexcept
+        : data_(tag, args...)
+    {
+    }
+
+    ///
+    /// @brief Constructs shared_resources by moving arguments in the order of the effective type list
+    /// @tparam Args The types of the arguments, equal to the effective type list
+    /// @param tag The in_order tag
+    /// @param args The arguments to move into the shared resources
+    ///
+    template <typename... Args>
+        requires std::same_as<list, type_list<Args...>>
+    constexpr shared_resources(in_order_t tag, Args &&...args) noexcept
+        : data_(tag, std::move(args)...)
+    {
+    }
+
     ///
     /// @brief Default copy constructor
     /// @param other The other shared_resources to copy from
@@ -597,10 +1277,152 @@ public:
         return data_.template get<U>();
     }
 
+    ///
+    /// @brief Gets the implementation of interface I held by a slot providing it, such as implements<I, Impl>
+    /// @tparam I The interface type
+    /// @return A reference to the implementation, typed as the implementation_type of the slot
+    ///
+    template <typename I>
+        requires internals::implemented_concept<I, list>
+    constexpr auto &get() noexcept
+    {
+        static_assert(internals::type_list_size<typename internals::implementations_of<I, list>::type>::value == 1,
+                      "the interface is implemented by more than one slot; get the slot itself instead");
+        return data_.template get<implementation_slot<I>>().get();
+    }
+
+    ///
+    /// @brief Gets the implementation of interface I held by a slot providing it, such as implements<I, Impl>
+    /// @tparam I The interface type
+    /// @return A const reference to the implementation, typed as the implementation_type of the slot
+    ///
+    template <typename I>
+        requires internals::implemented_concept<I, list>
+    constexpr auto const &get() const noexcept
+    {
+        static_assert(internals::type_list_size<typename internals::implementations_of<I, list>::type>::value == 1,
+                      "the interface is implemented by more than one slot; get the slot itself instead");
+        return data_.template get<implementation_slot<I>>().get();
+    }
+
+    ///
+    /// @brief Gets the unique resource derived from Base, resolved at compile time
+    /// @tparam Base The base type, which is not stored itself
+    /// @return A reference to the derived resource, typed as the derived type so calls on it can be devirtualized
+    ///
+    template <typename Base>
+        requires internals::derived_member_concept<Base, list>
+    constexpr typename internals::type_at<0, typename internals::derived_members<Base, list>::type>::type &get() noexcept
+    {
+        static_assert(internals::type_list_size<typename internals::derived_members<Base, list>::type>::value == 1,
+                      "more than one resource derives from the requested base; get the derived type instead");
+        return data_.template get<derived_member<Base>>();
+    }
+
+    ///
+    /// @brief Gets the unique resource derived from Base, resolved at compile time
+    /// @tparam Base The base type, which is not stored itself
+    /// @return A const reference to the derived resource, typed as the derived type so calls on it can be devirtualized
+    ///
+    template <typename Base>
+        requires internals::derived_member_concept<Base, list>
+    constexpr typename internals::type_at<0, typename internals::derived_members<Base, list>::type>::type const &get() const noexcept
+    {
+        static_assert(internals::type_list_size<typename internals::derived_members<Base, list>::type>::value == 1,
+                      "more than one resource derives from the requested base; get the derived type instead");
+        return data_.template get<derived_member<Base>>();
+    }
+
+    ///
+    /// @brief Calls fn on the implementation held by the slot of type U, such as one_of<Impls...>
+    /// @tparam U The type of the slot
+    /// @tparam Fn The type of the function
+    /// @param fn The function
+    /// @return The result of fn
+    ///
+    template <typename U, typename Fn>
+        requires internals::contains_concept<U, list> && requires(U &slot, Fn &&fn) { slot.visit(std::forward<Fn>(fn)); }
+    constexpr decltype(auto) visit(Fn &&fn)
+    {
+        return data_.template get<U>().visit(std::forward<Fn>(fn));
+    }
+
+    ///
+    /// @brief Calls fn on the implementation held by the slot of type U, such as one_of<Impls...>
+    /// @tparam U The type of the slot
+    /// @tparam Fn The type of the function
+    /// @param fn The function
+    /// @return The result of fn
+    ///
+    template <typename U, typename Fn>
+        requires internals::contains_concept<U, list> && requires(U const &slot, Fn &&fn) { slot.visit(std::forward<Fn>(fn)); }
+    constexpr decltype(auto) visit(Fn &&fn) const
+    {
+        return data_.template get<U>().visit(std::forward<Fn>(fn));
+    }
+
+    ///
+    /// @brief Finds a shared resource by its runtime type_id
+    /// @param id The type_id of the resource, as given by type_id_of
+    /// @return The address of the resource, or nullptr if no resource has the type_id
+    ///
+    void *find(type_id id) noexcept
+    {
+        return internals::type_lookup<shared_resources, void *, list>::find(*this, id);
+    }
+
+    ///
+    /// @brief Finds a shared resource by its runtime type_id
+    /// @param id The type_id of the resource, as given by type_id_of
+    /// @return The address of the resource, or nullptr if no resource has the type_id
+    ///
+    void const *find(type_id id) const noexcept
+    {
+        return internals::type_lookup<shared_resources const, void const *, list>::find(*this, id);
+    }
+
+    ///
+    /// @brief Hints the CPU to load the resources of the given types, e.g. before a latency-critical loop
+    /// @tparam Us The types of the resources
+    /// @note Pointer-like resources, i.e. raw object pointers, std::unique_ptr and std::shared_ptr, also prefetch the object they point to
+    ///
+    template <typename... Us>
+        requires internals::contains_all_concept<type_list<Us...>, list>
+    void prefetch() const noexcept
+    {
+        (internals::prefetch_resource(get<Us>()), ...);
+    }
+
+    ///
+    /// @brief Hints the CPU to load every resource
+    ///
+    void prefetch_all() const noexcept
+    {
+        prefetch_all(list{});
+    }
+
 private:
+    ///
+    /// @brief Hints the CPU to load the resources of the given types
+    /// @tparam Ts The types of the resources
+    ///
+    template <typename... Ts>
+    void prefetch_all(type_list<Ts...>) const noexcept
+    {
+        prefetch<Ts...>();
+    }
+
     /// @brief The storage type for the shared resources
     using storage_type = internals::storage<list>;
 
+    /// @brief The first slot of the list providing interface I
+    template <typename I>
+    using implementation_slot = typename internals::type_at<0, typename internals::implementations_of<I, list>::type>::type;
+
+    /// @brief The first resource of the list derived from Base
+    template <typename Base>
+    using derived_member = typename internals::type_at<0, typename internals::derived_members<Base, list>::type>::type;
+
     /// @brief The storage for the shared resources
     storage_type data_;
 
@@ -655,6 +1477,9 @@ private:
     using list = typename internals::remove_types<List, Exclude...>::type;
 
 public:
+    /// @brief The effective type_list of the referred-to resources
+    using resource_list = list;
+
     ///
     /// @brief Constructs shared_references with the given arguments
     /// @tparam Args The types of the arguments
@@ -691,7 +1516,46 @@ public:
         return data_.template get<std::reference_wrapper<U>>().get();
     }
 
+    ///
+    /// @brief Finds a referred-to resource by its runtime type_id
+    /// @param id The type_id of the resource, as given by type_id_of
+    /// @return The address of the resource, or nullptr if no resource has the type_id
+    ///
+    void *find(type_id id) const noexcept
+    {
+        return internals::type_lookup<shared_references const, void *, list>::find(*this, id);
+    }
+
+    ///
+    /// @brief Hints the CPU to load the referred-to resources of the given types
+    /// @tparam Us The types of the resources
+    ///
+    template <typename... Us>
+        requires internals::contains_all_concept<type_list<Us...>, list>
+    void prefetch() const noexcept
+    {
+        (internals::prefetch_region(std::addressof(get<Us>()), sizeof(Us)), ...);
+    }
+
+    ///
+    /// @brief Hints the CPU to load every referred-to resource
+    ///
+    void prefetch_all() const noexcept
+    {
+        prefetch_all(list{});
+    }
+
 private:
+    ///
+    /// @brief Hints the CPU to load the resources of the given types
+    /// @tparam Ts The types of the resources
+    ///
+    template <typename... Ts>
+    void prefetch_all(type_list<Ts...>) const noexcept
+    {
+        prefetch<Ts...>();
+    }
+
     /// @brief The wrapped type_list with std::reference_wrapper
     using wrapped_list = typename internals::wrap_with_reference<List>::type;
 
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2026 Kuro Amami
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+///
+/// @file versioned_resources.hpp
+///
+
+#ifndef SHARED_RESOURCES_VERSIONED_RESOURCES_HPP
+#define SHARED_RESOURCES_VERSIONED_RESOURCES_HPP
+
+#include <shared_resources/shared_resources.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace srs
+{
+
+///
+/// @brief Provides shared resources with a generation counter per resource
+/// @tparam List A type_list of resource types to share
+/// @tparam Exclude The types to exclude from List
+/// @note The generation of a resource is bumped whenever it is accessed mutably or touched, so consumers can detect
+///       changes by comparing integers. Like shared_resources, versioned_resources is not synchronized.
+///
+template <type_list_concept List, typename... Exclude>
+class versioned_resources
+{
+private:
+    /// @brief The underlying bundle
+    using resources_type = shared_resources<List, Exclude...>;
+
+public:
+    /// @brief The effective type_list of the stored resources
+    using resource_list = typename resources_type::resource_list;
+
+    /// @brief The type of a generation counter
+    using generation_type = std::uint64_t;
+
+    /// @brief The type of the generations of all resources, in resource_list order
+    using version_vector = std::array<generation_type, internals::type_list_size<resource_list>::value>;
+
+    ///
+    /// @brief Constructs versioned_resources like a shared_resources; every generation starts at 0
+    /// @tparam Args The types of the arguments
+    /// @param args The arguments to construct the shared_resources with
+    ///
+    template <typename... Args>
+        requires std::constructible_from<resources_type, Args...>
+    constexpr versioned_resources(Args &&...args) noexcept(std::is_nothrow_constructible_v<resources_type, Args...>)
+        : resources_(std::forward<Args>(args)...)
+    {
+    }
+
+    ///
+    /// @brief Gets a reference to the resource of type U and bumps its generation
+    /// @tparam U The type of the resource to get
+    /// @return A reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr U &get() noexcept
+    {
+        touch<U>();
+        return resources_.template get<U>();
+    }
+
+    ///
+    /// @brief Gets a const reference to the resource of type U without bumping its generation
+    /// @tparam U The type of the resource to get
+    /// @return A const reference to the resource of type U
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr U const &get() const noexcept
+    {
+        return resources_.template get<U>();
+    }
+
+    ///
+    /// @brief Bumps the generation of the resource of type U, e.g. after changing it through a kept reference
+    /// @tparam U The type of the resource
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr void touch() noexcept
+    {
+        ++generations_[internals::index_of<U, resource_list>::value];
+        ++version_;
+    }
+
+    ///
+    /// @brief Gets the generation of the resource of type U
+    /// @tparam U The type of the resource
+    /// @return The number of times the resource was accessed mutably or touched
+    ///
+    template <typename U>
+        requires internals::contains_concept<U, resource_list>
+    constexpr generation_type generation() const noexcept
+    {
+        return generations_[internals::index_of<U, resource_list>::value];
+    }
+
+    ///
+    /// @brief Gets the generations of all resources
+    /// @return The generations, in resource_list order
+    ///
+    constexpr version_vector const &generations() const noexcept
+    {
+        return generations_;
+    }
+
+    ///
+    /// @brief Gets the version of the bundle
+    /// @return The sum of the generations of all resources
+    ///
+    constexpr generation_type version() const noexcept
+    {
+        return version_;
+    }
+
+    ///
+    /// @brief Gets the underlying shared_resources without bumping any generation
+    /// @return A const reference to the underlying shared_resources
+    ///
+    constexpr resources_type const &resources() const noexcept
+    {
+        return resources_;
+    }
+
+private:
+    /// @brief The resources
+    resources_type resources_;
+
+    /// @brief The generation of each resource
+    version_vector generations_{};
+
+    /// @brief The sum of the generations
+    generation_type version_ = 0;
+};
+
+}  // namespace srs
+
+#endif  // SHARED_RESOURCES_VERSIONED_RESOURCES_HPP
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <shared_resources/ambient.hpp>
+
+#include <string>
+#include <thread>
+
+namespace
+{
+using all = srs::type_list<int, char, std::string>;
+
+int read_int()
+{
+    return srs::current<int>();
+}
+
+template <typename Bundle>
+concept scopable = requires { typename srs::scope<Bundle>; };
+}  // namespace
+
+TEST(ambient_test, scope)
+{
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+
+    srs::shared_resources<all> outer(1, 'a', std::string("outer"));
+    {
+        srs::scope s(outer);
+        EXPECT_EQ(read_int(), 1);
+        EXPECT_EQ(&srs::current<char>(), &outer.get<char>());
+
+        int a = 2;
+        std::string b = "inner";
+        srs::shared_references<all, char> inner(a, b);
+        {
+            srs::scope t(inner);
+            EXPECT_EQ(read_int(), 2);
+            EXPECT_EQ(srs::current<std::string>(), "inner");
+            EXPECT_EQ(srs::current<char>(), 'a');
+        }
+        EXPECT_EQ(read_int(), 1);
+
+        std::thread([] { EXPECT_EQ(srs::try_current<int>(), nullptr); }).join();
+    }
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+}
+
+TEST(ambient_test, const_bundle)
+{
+    // current<T>() gives mutable access, so only non-const bundles can be installed
+    static_assert(scopable<srs::shared_resources<all>>);
+    static_assert(scopable<srs::shared_references<all>>);
+    static_assert(!scopable<srs::shared_resources<all> const>);
+    static_assert(!scopable<srs::shared_references<all> const>);
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <shared_resources/ambient_coroutine.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+using all = srs::type_list<int, char>;
+
+struct task
+{
+    struct promise_type : srs::ambient_promise<all>
+    {
+        task get_return_object()
+        {
+            return { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        auto initial_suspend()
+        {
+            return ambient_initial_suspend(std::suspend_never{});
+        }
+
+        auto final_suspend() noexcept
+        {
+            return ambient_final_suspend(std::suspend_always{});
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            ambient_unhandled_exception();
+            throw;
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Resumes the awaiting coroutine on a new thread
+struct resume_on_new_thread
+{
+    std::thread *thread;
+
+    bool await_ready()
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        *thread = std::thread([handle] { handle.resume(); });
+    }
+
+    void await_resume()
+    {
+    }
+};
+
+task run(std::thread *thread, int *seen_int, char *seen_char, int *scoped)
+{
+    co_await resume_on_new_thread{ thread };
+    *seen_int  = srs::current<int>();
+    *seen_char = srs::current<char>();
+
+    int local = 3;
+    srs::shared_references<all, char> inner(local);
+    srs::scope s(inner);
+    co_await std::suspend_never{};
+    *scoped = srs::current<int>();
+}
+
+struct generator
+{
+    struct promise_type : srs::ambient_promise<all>
+    {
+        generator get_return_object()
+        {
+            return { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        auto initial_suspend()
+        {
+            return ambient_initial_suspend(std::suspend_always{});
+        }
+
+        auto final_suspend() noexcept
+        {
+            return ambient_final_suspend(std::suspend_always{});
+        }
+
+        auto yield_value(int value)
+        {
+            current = value;
+            return ambient_yield_value(std::suspend_always{});
+        }
+
+        void return_void()
+        {
+        }
+
+        int current = 0;
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+generator count()
+{
+    co_yield srs::current<int>();
+
+    int local = 3;
+    srs::shared_references<all, char> inner(local);
+    srs::scope s(inner);
+    co_yield srs::current<int>();
+    co_yield srs::current<int>();
+}
+
+task fail(int *seen_int)
+{
+    co_await std::suspend_always{};
+    *seen_int = srs::current<int>();
+
+    int local = 3;
+    srs::shared_references<all, char> inner(local);
+    srs::scope s(inner);
+    throw std::runtime_error("fail");
+}
+}  // namespace
+
+TEST(ambient_coroutine_test, migrate)
+{
+    srs::shared_resources<all> resources(1, 'a');
+    std::thread thread;
+    int seen_int   = 0;
+    char seen_char = 0;
+    int scoped     = 0;
+    task t;
+    {
+        srs::scope s(resources);
+        t = run(&thread, &seen_int, &seen_char, &scoped);
+    }
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+    thread.join();
+    EXPECT_EQ(seen_int, 1);
+    EXPECT_EQ(seen_char, 'a');
+    EXPECT_EQ(scoped, 3);
+    EXPECT_TRUE(t.handle.done());
+    t.handle.destroy();
+}
+
+TEST(ambient_coroutine_test, exception)
+{
+    srs::shared_resources<all> resources(1, 'a');
+    int seen_int = 0;
+    task t;
+    {
+        srs::scope s(resources);
+        t = fail(&seen_int);
+    }
+
+    // The exception leaves the coroutine on a thread without scopes, which gets its own ambient resources back
+    EXPECT_THROW(t.handle.resume(), std::runtime_error);
+    EXPECT_EQ(seen_int, 1);
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+    EXPECT_EQ(srs::try_current<char>(), nullptr);
+    EXPECT_TRUE(t.handle.done());
+    t.handle.destroy();
+}
+
+TEST(ambient_coroutine_test, yield)
+{
+    srs::shared_resources<all> resources(1, 'a');
+    generator g;
+    {
+        srs::scope s(resources);
+        g = count();
+    }
+
+    // Each co_yield gives the thread its own ambient resources back, and resuming enters the coroutine's again
+    g.handle.resume();
+    EXPECT_EQ(g.handle.promise().current, 1);
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+
+    g.handle.resume();
+    EXPECT_EQ(g.handle.promise().current, 3);
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+
+    srs::shared_resources<all> other(2, 'b');
+    {
+        srs::scope s(other);
+        g.handle.resume();
+        EXPECT_EQ(g.handle.promise().current, 3);
+        EXPECT_EQ(srs::current<int>(), 2);
+    }
+
+    g.handle.resume();
+    EXPECT_TRUE(g.handle.done());
+    EXPECT_EQ(srs::try_current<int>(), nullptr);
+    g.handle.destroy();
+}
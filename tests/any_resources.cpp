@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <shared_resources/any_resources.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+using all = srs::type_list<int, char, std::string>;
+
+struct big
+{
+    std::array<int, 64> values{};
+};
+
+template <int N>
+struct alignas(16) wide
+{
+    char value = N;
+    char padding[15]{};
+};
+
+template <int N>
+struct narrow
+{
+    char value = N;
+};
+}  // namespace
+
+TEST(any_resources_test, emplace)
+{
+    srs::any_resources resources;
+    resources.emplace<int>(1);
+    resources.insert(std::string("hello"));
+    resources.emplace<big>().values[3] = 4;
+    EXPECT_EQ(resources.size(), 3u);
+    EXPECT_EQ(resources.get<int>(), 1);
+    EXPECT_EQ(resources.get<std::string>(), "hello");
+    EXPECT_EQ(resources.get<big>().values[3], 4);
+    EXPECT_EQ(resources.try_get<char>(), nullptr);
+    EXPECT_THROW(resources.get<char>(), std::out_of_range);
+    EXPECT_EQ(resources.find(srs::type_id_of<int>), &resources.get<int>());
+
+    resources.emplace<int>(2);
+    EXPECT_EQ(resources.size(), 3u);
+    EXPECT_EQ(resources.get<int>(), 2);
+
+    srs::any_resources copy(resources);
+    copy.get<big>().values[3] = 5;
+    EXPECT_EQ(resources.get<big>().values[3], 4);
+    EXPECT_EQ(copy.get<std::string>(), "hello");
+
+    EXPECT_TRUE(resources.erase<std::string>());
+    EXPECT_FALSE(resources.contains<std::string>());
+    EXPECT_FALSE(resources.erase<std::string>());
+}
+
+TEST(any_resources_test, convert)
+{
+    srs::shared_resources<all> typed(1, 'a', std::string("hello"));
+    srs::any_resources resources(typed);
+    EXPECT_EQ(resources.get<char>(), 'a');
+
+    auto back = resources.as<srs::shared_resources<all, int>>();
+    EXPECT_EQ(back.get<std::string>(), "hello");
+
+    auto references = resources.as<srs::shared_references<all>>();
+    references.get<int>() = 2;
+    EXPECT_EQ(resources.get<int>(), 2);
+
+    int a = 3;
+    char b = 'b';
+    std::string c = "world";
+    srs::any_resources from_references(srs::shared_references<all>(a, b, c));
+    EXPECT_EQ(from_references.get<std::string>(), "world");
+    EXPECT_THROW(srs::any_resources().as<srs::shared_resources<all>>(), std::out_of_range);
+}
+
+TEST(any_resources_test, mixed_alignment)
+{
+    // Packed in insertion order the slots need no padding, but in type index order they may need up to 15 bytes each
+    srs::any_resources resources;
+    [&]<int... Is>(std::integer_sequence<int, Is...>) {
+        (resources.emplace<wide<Is>>(), ...);
+        (resources.emplace<narrow<Is>>(), ...);
+
+        srs::any_resources const copy(resources);
+        EXPECT_TRUE(((copy.get<wide<Is>>().value == Is) && ...));
+        EXPECT_TRUE(((copy.get<narrow<Is>>().value == Is) && ...));
+
+        // Growing relocates the slots in type index order too
+        (resources.emplace<wide<Is + 16>>(), ...);
+        (resources.emplace<narrow<Is + 16>>(), ...);
+        EXPECT_EQ(resources.size(), 64u);
+        EXPECT_TRUE(((resources.get<wide<Is>>().value == Is) && ...));
+        EXPECT_TRUE(((reinterpret_cast<std::uintptr_t>(&resources.get<wide<Is + 16>>()) % 16 == 0) && ...));
+    }(std::make_integer_sequence<int, 16>{});
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <shared_resources/batch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using all = srs::type_list<int, char, double>;
+}  // namespace
+
+TEST(batch_test, make_batch)
+{
+    std::vector<double> doubles{ 0.5, 1.5, 2.5 };
+    std::vector<int> ints{ 1, 2, 3 };
+    std::vector<char> chars{ 'a', 'b', 'c' };
+
+    auto bundles = srs::make_batch<srs::shared_resources<all>>(doubles, ints, chars);
+    ASSERT_EQ(bundles.size(), 3u);
+    EXPECT_EQ(bundles[1].get<int>(), 2);
+    EXPECT_EQ(bundles[1].get<char>(), 'b');
+    EXPECT_EQ(bundles[2].get<double>(), 2.5);
+
+    auto excluded = srs::make_batch<srs::shared_resources<all, double>>(chars, ints);
+    EXPECT_EQ(excluded[0].get<char>(), 'a');
+
+    chars.pop_back();
+    EXPECT_THROW(srs::make_batch<srs::shared_resources<all>>(doubles, ints, chars), std::invalid_argument);
+}
+
+TEST(batch_test, par_make_batch)
+{
+    std::size_t const size = srs::batch_grain * 4 + 3;
+    std::vector<int> ints(size);
+    std::vector<char> chars(size);
+    std::vector<double> doubles(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        ints[i]    = static_cast<int>(i);
+        chars[i]   = static_cast<char>('a' + i % 26);
+        doubles[i] = static_cast<double>(i) / 2;
+    }
+
+    using bundle = srs::shared_resources<all>;
+    std::allocator<bundle> allocator;
+    bundle *const bundles = allocator.allocate(size);
+    srs::par_make_batch<bundle>(bundles, ints, chars, doubles);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(bundles[i].get<int>(), ints[i]);
+        ASSERT_EQ(bundles[i].get<char>(), chars[i]);
+        ASSERT_EQ(bundles[i].get<double>(), doubles[i]);
+    }
+    std::destroy_n(bundles, size);
+    allocator.deallocate(bundles, size);
+}
+
+TEST(batch_test, par_make_batch_throws)
+{
+    static std::atomic<int> live{ 0 };
+
+    // Neither default-constructible nor assignable
+    struct counted
+    {
+        explicit counted(int value) noexcept
+            : value(value)
+        {
+            ++live;
+        }
+
+        counted(counted const &other) noexcept
+            : value(other.value)
+        {
+            ++live;
+        }
+
+        counted &operator=(counted const &) = delete;
+
+        ~counted()
+        {
+            --live;
+        }
+
+        int value;
+    };
+
+    using bundle           = srs::shared_resources<srs::type_list<counted, int>>;
+    std::size_t const size = srs::batch_grain * 4;
+    std::vector<counted> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values.emplace_back(static_cast<int>(i));
+    }
+    int failing = -1;
+    auto const ints = std::views::iota(0, static_cast<int>(size)) | std::views::transform([&](int row) {
+                          if (row == failing)
+                          {
+                              throw std::runtime_error("unreadable row");
+                          }
+                          return row;
+                      });
+
+    std::allocator<bundle> allocator;
+    bundle *const bundles = allocator.allocate(size);
+    srs::par_make_batch<bundle>(bundles, values, ints);
+    EXPECT_EQ(live.load(), static_cast<int>(size * 2));
+    EXPECT_EQ(bundles[size - 1].get<counted>().value, static_cast<int>(size - 1));
+    EXPECT_EQ(bundles[size - 1].get<int>(), static_cast<int>(size - 1));
+    std::destroy_n(bundles, size);
+
+    // A failed row leaves no bundle behind
+    failing = static_cast<int>(size / 2 + 7);
+    EXPECT_THROW(srs::par_make_batch<bundle>(bundles, values, ints), std::runtime_error);
+    EXPECT_EQ(live.load(), static_cast<int>(size));
+    allocator.deallocate(bundles, size);
+}
+
+TEST(batch_test, in_order)
+{
+    srs::shared_resources<all> resources(srs::in_order, 1, 'a', 0.5);
+    EXPECT_EQ(resources.get<int>(), 1);
+    EXPECT_EQ(resources.get<char>(), 'a');
+    EXPECT_EQ(resources.get<double>(), 0.5);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <shared_resources/builder.hpp>
+
+#include <string>
+
+namespace
+{
+///
+/// @brief Counts its copies and moves
+///
+struct counted
+{
+    explicit counted(int value)
+        : value(value)
+    {
+    }
+
+    counted(counted const &other)
+        : value(other.value), copies(other.copies + 1), moves(other.moves)
+    {
+    }
+
+    counted(counted &&other) noexcept
+        : value(other.value), copies(other.copies), moves(other.moves + 1)
+    {
+    }
+
+    int value;
+    int copies = 0;
+    int moves  = 0;
+};
+
+using bundle = srs::shared_resources<srs::type_list<counted, std::string, int>>;
+
+template <typename Builder>
+concept buildable = requires(Builder b) { std::move(b).build(); };
+}  // namespace
+
+TEST(builder_test, build)
+{
+    auto partial = srs::builder<bundle>().set<std::string>("name").set<int>(7);
+    static_assert(decltype(partial)::filled<int>());
+    static_assert(!decltype(partial)::filled<counted>());
+    static_assert(!buildable<decltype(partial)>);
+
+    auto complete = std::move(partial).set<counted>(42);
+    static_assert(buildable<decltype(complete)>);
+
+    bundle const resources = std::move(complete).build();
+    EXPECT_EQ(resources.get<std::string>(), "name");
+    EXPECT_EQ(resources.get<int>(), 7);
+    EXPECT_EQ(resources.get<counted>().value, 42);
+    EXPECT_EQ(resources.get<counted>().copies, 0);
+    EXPECT_EQ(resources.get<counted>().moves, 1);
+}
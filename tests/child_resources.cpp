@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <shared_resources/child_resources.hpp>
+
+#include <string>
+
+namespace
+{
+using all = srs::type_list<int, char, std::string, double>;
+}  // namespace
+
+TEST(child_resources_test, get)
+{
+    srs::shared_resources<all, double> process(1, 'a', std::string("process"));
+    srs::child_resources<srs::shared_resources<all, double>, srs::type_list<std::string, double>> tenant(process, std::string("tenant"), 0.5);
+    EXPECT_EQ(tenant.get<int>(), 1);
+    EXPECT_EQ(tenant.get<std::string>(), "tenant");
+    EXPECT_EQ(tenant.get<double>(), 0.5);
+    EXPECT_EQ(&tenant.get<char>(), &process.get<char>());
+
+    tenant.get<int>() = 2;
+    EXPECT_EQ(process.get<int>(), 2);
+
+    using tenant_type = decltype(tenant);
+    srs::child_resources<tenant_type const, srs::type_list<int>> request(tenant, 3);
+    EXPECT_EQ(request.get<int>(), 3);
+    EXPECT_EQ(request.get<std::string>(), "tenant");
+    EXPECT_EQ(request.get<char>(), 'a');
+    EXPECT_EQ(&request.parent(), &tenant);
+    static_assert(std::is_same_v<decltype(request.get<char>()), char const &>);
+    static_assert(std::is_same_v<tenant_type::resource_list, srs::type_list<std::string, double, int, char>>);
+}
+
+TEST(child_resources_test, references)
+{
+    int a = 1;
+    char b = 'a';
+    srs::shared_references<all, std::string, double> references(a, b);
+    srs::child_resources<srs::shared_references<all, std::string, double>, all, int, char> child(references, std::string("child"), 0.5);
+    child.get<char>() = 'b';
+    EXPECT_EQ(b, 'b');
+    EXPECT_EQ(child.get<std::string>(), "child");
+}
@@ -0,0 +1,326 @@
+#include <gtest/gtest.h>
+#include <shared_resources/concurrent_resources.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using config = srs::concurrent_resources<srs::type_list<int, std::string, double>>;
+using changes = srs::change_set<config::resource_list>;
+}  // namespace
+
+TEST(concurrent_resources_test, read)
+{
+    config resources(1, std::string("one"), 1.5);
+
+    auto view = resources.read();
+    EXPECT_EQ(view.get<int>(), 1);
+    EXPECT_EQ(view.get<std::string>(), "one");
+
+    resources.store(2);
+    resources.update<std::string>([](std::string &value) { value += "!"; });
+
+    // The view keeps seeing its snapshot
+    EXPECT_EQ(view.get<int>(), 1);
+    EXPECT_EQ(view.get<std::string>(), "one");
+    EXPECT_EQ(resources.read().get<int>(), 2);
+    EXPECT_EQ(resources.read().get<std::string>(), "one!");
+    EXPECT_EQ(*resources.load<double>(), 1.5);
+}
+
+TEST(concurrent_resources_test, change_set)
+{
+    EXPECT_EQ(changes::of<>().mask(), 0b111u);
+    EXPECT_EQ((changes::of<int, double>().mask()), 0b101u);
+    EXPECT_TRUE(changes::of<double>().contains<double>());
+    EXPECT_FALSE(changes::of<double>().contains<int>());
+}
+
+TEST(concurrent_resources_test, subscribe)
+{
+    config resources(0, std::string(), 0.0);
+
+    std::vector<std::function<void()>> queue;
+    auto const queued = [&](std::function<void()> task) { queue.push_back(std::move(task)); };
+
+    std::vector<std::uint64_t> int_calls;
+    std::vector<std::uint64_t> all_calls;
+    std::vector<std::uint64_t> inline_calls;
+    auto int_subscription    = resources.subscribe<int>([&](changes changed) { int_calls.push_back(changed.mask()); }, queued);
+    auto all_subscription    = resources.subscribe([&](changes changed) { all_calls.push_back(changed.mask()); }, queued);
+    auto inline_subscription = resources.subscribe<double>([&](changes changed) { inline_calls.push_back(changed.mask()); });
+
+    for (int i = 1; i <= 100; ++i)
+    {
+        resources.store(i);
+    }
+    resources.store(std::string("burst"));
+
+    // The burst is coalesced into one pending delivery per subscriber
+    ASSERT_EQ(queue.size(), 2u);
+    EXPECT_TRUE(int_calls.empty());
+    EXPECT_TRUE(inline_calls.empty());
+    for (auto &task : queue)
+    {
+        task();
+    }
+    queue.clear();
+    EXPECT_EQ(int_calls, std::vector<std::uint64_t>{ changes::of<int>().mask() });
+    EXPECT_EQ(all_calls, (std::vector<std::uint64_t>{ changes::of<int, std::string>().mask() }));
+
+    resources.store(2.5);
+    EXPECT_EQ(inline_calls, std::vector<std::uint64_t>{ changes::of<double>().mask() });
+    ASSERT_EQ(queue.size(), 1u);
+
+    // A cancelled subscription drops pending changes
+    all_subscription.reset();
+    queue.front()();
+    EXPECT_EQ(all_calls.size(), 1u);
+
+    int_subscription.reset();
+    queue.clear();
+    resources.store(3);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(concurrent_resources_test, reassign_subscription)
+{
+    config resources(0, std::string(), 0.0);
+
+    int first  = 0;
+    int second = 0;
+    auto subscription = resources.subscribe<int>([&](changes) { ++first; });
+    resources.store(1);
+
+    // Assigning a new subscription cancels the old one
+    subscription = resources.subscribe<int>([&](changes) { ++second; });
+    resources.store(2);
+    EXPECT_EQ(first, 1);
+    EXPECT_EQ(second, 1);
+}
+
+TEST(concurrent_resources_test, throwing_subscribers)
+{
+    config resources(0, std::string(), 0.0);
+
+    int thrown = 0;
+    int calls  = 0;
+    auto throwing = resources.subscribe<int>([&](changes) {
+        ++thrown;
+        throw std::runtime_error("callback");
+    });
+    auto counting = resources.subscribe<int>([&](changes) { ++calls; });
+
+    // A throwing callback reaches neither the writer nor the other subscribers, and keeps being called
+    EXPECT_NO_THROW(resources.store(1));
+    EXPECT_NO_THROW(resources.store(2));
+    EXPECT_EQ(thrown, 2);
+    EXPECT_EQ(calls, 2);
+
+    bool fail = true;
+    std::vector<std::uint64_t> delivered;
+    auto failing_executor = resources.subscribe(
+        [&](changes changed) { delivered.push_back(changed.mask()); },
+        [&](std::function<void()> task) {
+            if (std::exchange(fail, false))
+            {
+                throw std::runtime_error("executor");
+            }
+            task();
+        });
+
+    // Changes whose posting failed are delivered with the next change
+    EXPECT_NO_THROW(resources.store(3));
+    EXPECT_TRUE(delivered.empty());
+    resources.store(std::string("next"));
+    EXPECT_EQ(delivered, (std::vector<std::uint64_t>{ changes::of<int, std::string>().mask() }));
+}
+
+TEST(concurrent_resources_test, concurrent)
+{
+    config resources(0, std::string("0"), 0.0);
+    std::atomic<int> notified{ 0 };
+    auto subscription = resources.subscribe<int>([&](changes) { ++notified; });
+
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&] {
+            int last = 0;
+            while (!done.load())
+            {
+                auto view   = resources.read();
+                int current = view.get<int>();
+                EXPECT_GE(current, last);
+                last = current;
+            }
+        });
+    }
+
+    std::thread writer([&] {
+        for (int i = 1; i <= 2000; ++i)
+        {
+            resources.store(i);
+        }
+    });
+    for (int i = 1; i <= 200; ++i)
+    {
+        resources.update<std::string>([&](std::string &value) { value = std::to_string(i); });
+        resources.update<double>([&](double &value) { value = i; });
+    }
+    writer.join();
+    done.store(true);
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(resources.read().get<int>(), 2000);
+    EXPECT_EQ(notified.load(), 2000);
+}
+
+TEST(concurrent_resources_test, subscribe_thread_pool)
+{
+    config resources(0, std::string(), 0.0);
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+    auto const pooled = [&](std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        ready.notify_one();
+    };
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t)
+    {
+        pool.emplace_back([&] {
+            std::unique_lock lock(mutex);
+            while (true)
+            {
+                ready.wait(lock, [&] { return stopping || !tasks.empty(); });
+                if (tasks.empty())
+                {
+                    return;
+                }
+                auto task = std::move(tasks.front());
+                tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        });
+    }
+
+    std::atomic<int> running{ 0 };
+    std::atomic<bool> overlapped{ false };
+    std::atomic<int> seen{ 0 };
+    auto subscription = resources.subscribe<int>(
+        [&](changes) {
+            if (running.fetch_add(1) != 0)
+            {
+                overlapped.store(true);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            seen.store(resources.read().get<int>());
+            running.fetch_sub(1);
+        },
+        pooled);
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t)
+    {
+        writers.emplace_back([&, t] {
+            for (int i = 1; i <= 500; ++i)
+            {
+                resources.update<int>([&](int &value) { value += 1; });
+                if (i % 50 == t)
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            }
+        });
+    }
+    for (auto &writer : writers)
+    {
+        writer.join();
+    }
+
+    // Callbacks of one subscriber never overlap, and the last change is still delivered
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (seen.load() != 2000 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(seen.load(), 2000);
+    EXPECT_FALSE(overlapped.load());
+
+    subscription.reset();
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    ready.notify_all();
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+}
+
+TEST(concurrent_resources_test, transaction)
+{
+    config resources(0, std::string("0"), 0.0);
+    std::vector<std::uint64_t> calls;
+    auto subscription = resources.subscribe([&](changes changed) { calls.push_back(changed.mask()); });
+
+    auto transaction = resources.begin_transaction();
+    transaction.store(1).update<std::string>([](std::string &value) { value = "1"; });
+    transaction.update<int>([](int &value) { value *= 10; });
+    EXPECT_EQ(resources.read().get<int>(), 0);
+
+    transaction.commit();
+    EXPECT_EQ(resources.read().get<int>(), 10);
+    EXPECT_EQ(resources.read().get<std::string>(), "1");
+    EXPECT_EQ(calls, (std::vector<std::uint64_t>{ changes::of<int, std::string>().mask() }));
+
+    // A throwing step publishes nothing
+    transaction.store(2.0).update<int>([](int &) { throw std::runtime_error("rejected"); });
+    EXPECT_THROW(transaction.commit(), std::runtime_error);
+    EXPECT_EQ(resources.read().get<double>(), 0.0);
+    EXPECT_EQ(calls.size(), 1u);
+}
+
+TEST(concurrent_resources_test, transaction_concurrent)
+{
+    config resources(0, std::string("0"), 0.0);
+
+    std::atomic<bool> done{ false };
+    std::thread reader([&] {
+        while (!done.load())
+        {
+            auto view = resources.read();
+            EXPECT_EQ(std::to_string(view.get<int>()), view.get<std::string>());
+            EXPECT_EQ(view.get<int>(), static_cast<int>(view.get<double>()));
+        }
+    });
+    for (int i = 1; i <= 2000; ++i)
+    {
+        resources.begin_transaction().store(i).store(std::to_string(i)).store(static_cast<double>(i)).commit();
+    }
+    done.store(true);
+    reader.join();
+}
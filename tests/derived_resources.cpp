@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <shared_resources/derived_resources.hpp>
+
+#include <string>
+
+namespace
+{
+int computed = 0;
+
+struct join
+{
+    std::string operator()(int const &a, char const &b) const
+    {
+        ++computed;
+        return std::to_string(a) + b;
+    }
+};
+
+struct length
+{
+    std::size_t operator()(std::string const &joined) const
+    {
+        return joined.size();
+    }
+};
+
+using base    = srs::versioned_resources<srs::type_list<int, char, double>>;
+using derived = srs::derived_resources<base,
+                                       srs::derived<std::string, srs::type_list<int, char>, join>,
+                                       srs::derived<std::size_t, srs::type_list<std::string>, length>>;
+}  // namespace
+
+TEST(derived_resources_test, incremental)
+{
+    computed = 0;
+    derived resources(1, 'a', 0.5);
+    EXPECT_EQ(computed, 0);
+    EXPECT_EQ(resources.get<std::string>(), "1a");
+    EXPECT_EQ(resources.get<std::string>(), "1a");
+    EXPECT_EQ(resources.get<std::size_t>(), 2u);
+    EXPECT_EQ(computed, 1);
+
+    resources.get<double>() = 1.5;
+    EXPECT_EQ(resources.get<std::size_t>(), 2u);
+    EXPECT_EQ(computed, 1);
+
+    resources.get<int>() = 10;
+    EXPECT_EQ(resources.get<std::size_t>(), 3u);
+    EXPECT_EQ(resources.get<std::string>(), "10a");
+    EXPECT_EQ(computed, 2);
+    EXPECT_EQ(resources.generation<std::string>(), 2u);
+    EXPECT_EQ(resources.generation<std::size_t>(), 2u);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <shared_resources/expiring.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+///
+/// @brief Waits until a condition holds or a second has passed
+///
+template <typename Fn>
+bool eventually(Fn condition)
+{
+    auto const deadline = std::chrono::steady_clock::now() + 1s;
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+}  // namespace
+
+TEST(expiring_test, refresh_ahead)
+{
+    srs::refresh_scheduler scheduler;
+    std::atomic<int> fetched{ 0 };
+    srs::expiring<int> token(scheduler, [&] { return ++fetched; }, 50ms, 40ms);
+
+    // The first value is fetched inline
+    EXPECT_EQ(*token.load(), 1);
+    EXPECT_FALSE(token.expired());
+
+    srs::shared_resources<srs::type_list<srs::expiring<int>, std::string>> resources(token, std::string("service"));
+    EXPECT_TRUE(eventually([&] { return *resources.get<srs::expiring<int>>().load() >= 3; }));
+    EXPECT_FALSE(token.expired());
+}
+
+TEST(expiring_test, failed_refresh)
+{
+    srs::refresh_scheduler scheduler;
+    std::atomic<int> attempts{ 0 };
+    srs::expiring<std::string> address(
+        scheduler,
+        [&] {
+            if (attempts++ > 0)
+            {
+                throw std::runtime_error("unreachable");
+            }
+            return std::string("10.0.0.1");
+        },
+        20ms, 10ms);
+
+    // Readers keep the previous value while the refresher is retried
+    EXPECT_TRUE(eventually([&] { return attempts.load() >= 6; }));
+    EXPECT_EQ(*address.load(), "10.0.0.1");
+    EXPECT_TRUE(address.expired());
+}
+
+TEST(expiring_test, destroyed_before_refresh)
+{
+    srs::refresh_scheduler scheduler;
+    std::atomic<int> fetched{ 0 };
+    {
+        srs::expiring<int> stats(scheduler, [&] { return ++fetched; }, 10ms, 5ms);
+    }
+    std::this_thread::sleep_for(30ms);
+    EXPECT_EQ(fetched.load(), 1);
+}
+
+TEST(expiring_test, schedule_while_waiting)
+{
+    srs::refresh_scheduler scheduler;
+    auto const refresher = [] { return 0; };
+    srs::expiring<int> first(scheduler, refresher, 1h);
+
+    // Scheduling reallocates the pending refreshes while the scheduler thread waits for the first one
+    std::this_thread::sleep_for(10ms);
+    std::vector<srs::expiring<int>> slots;
+    for (int i = 0; i < 64; ++i)
+    {
+        slots.emplace_back(scheduler, refresher, 1h);
+    }
+
+    std::atomic<int> fetched{ 0 };
+    srs::expiring<int> soon(scheduler, [&] { return ++fetched; }, 20ms, 10ms);
+    EXPECT_TRUE(eventually([&] { return fetched.load() >= 3; }));
+}
+
+TEST(expiring_test, invalid_lead)
+{
+    srs::refresh_scheduler scheduler;
+    int fetched = 0;
+    auto const refresher = [&] { return ++fetched; };
+    EXPECT_THROW(srs::expiring<int>(scheduler, refresher, 10ms, 10ms), std::invalid_argument);
+    EXPECT_THROW(srs::expiring<int>(scheduler, refresher, 10ms, 20ms), std::invalid_argument);
+    EXPECT_THROW(srs::expiring<int>(scheduler, refresher, 10ms, -1ms), std::invalid_argument);
+    EXPECT_THROW(srs::expiring<int>(scheduler, refresher, 0ms), std::invalid_argument);
+
+    // Nothing is fetched for a rejected slot
+    EXPECT_EQ(fetched, 0);
+    srs::expiring<int> valid(scheduler, refresher, 10ms, 0ms);
+    EXPECT_EQ(*valid.load(), 1);
+}
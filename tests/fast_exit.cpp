@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <shared_resources/fast_exit.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> events;
+
+struct cache
+{
+    ~cache()
+    {
+        events.push_back("~cache");
+    }
+};
+
+struct log_sink
+{
+    void flush() noexcept
+    {
+        events.push_back("flush log_sink");
+    }
+
+    ~log_sink()
+    {
+        events.push_back("~log_sink");
+    }
+};
+
+struct connection
+{
+    ~connection()
+    {
+        events.push_back("~connection");
+    }
+};
+}  // namespace
+
+template <>
+struct srs::teardown_policy<cache>
+    : public std::integral_constant<srs::teardown, srs::teardown::leak>
+{
+};
+
+template <>
+struct srs::teardown_policy<log_sink>
+    : public std::integral_constant<srs::teardown, srs::teardown::leak>
+{
+};
+
+template <>
+struct srs::flush_hook<log_sink>
+{
+    static void run(log_sink &sink) noexcept
+    {
+        sink.flush();
+    }
+};
+
+namespace
+{
+using service = srs::shared_resources<srs::type_list<cache, log_sink, connection>>;
+}  // namespace
+
+TEST(fast_exit_test, per_type)
+{
+    {
+        service source(cache{}, log_sink{}, connection{});
+        events.clear();
+        srs::process_lifetime<service> resources(source);
+        static_assert(srs::process_lifetime<service>::leaks<cache>());
+        static_assert(!srs::process_lifetime<service>::leaks<connection>());
+        EXPECT_EQ(&resources.get<cache>(), &resources.bundle().get<cache>());
+    }
+    // The last three events come from destroying source
+    EXPECT_EQ(events, (std::vector<std::string>{ "~connection", "flush log_sink", "~connection", "~log_sink", "~cache" }));
+    events.clear();
+}
+
+TEST(fast_exit_test, leak_all)
+{
+    {
+        service source(cache{}, log_sink{}, connection{});
+        events.clear();
+        srs::process_lifetime<service, srs::teardown::leak> resources(source);
+    }
+    // Only flush_hook runs before source is destroyed
+    EXPECT_EQ(events, (std::vector<std::string>{ "flush log_sink", "~connection", "~log_sink", "~cache" }));
+    events.clear();
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <shared_resources/for_each.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace
+{
+using all = srs::type_list<int, char, long, short>;
+
+struct add_one
+{
+    template <typename T>
+    void operator()(T &value) const
+    {
+        value = static_cast<T>(value + 1);
+    }
+};
+}  // namespace
+
+TEST(for_each_test, sequential)
+{
+    srs::shared_resources<all> resources(1, 'a', 2L, short{ 3 });
+    srs::for_each(resources, add_one{});
+    EXPECT_EQ(resources.get<int>(), 2);
+    EXPECT_EQ(resources.get<char>(), 'b');
+    EXPECT_EQ(resources.get<long>(), 3L);
+    EXPECT_EQ(resources.get<short>(), 4);
+
+    int count = 0;
+    srs::shared_resources<all> const &const_resources = resources;
+    srs::for_each(const_resources, [&](auto const &) { ++count; });
+    EXPECT_EQ(count, 4);
+}
+
+TEST(for_each_test, references)
+{
+    int a   = 1;
+    char b  = 'a';
+    long c  = 2;
+    short d = 3;
+    srs::shared_references<all, short> references(a, b, c);
+    srs::for_each(references, add_one{});
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 'b');
+    EXPECT_EQ(c, 3L);
+    EXPECT_EQ(d, 3);
+}
+
+TEST(for_each_test, parallel)
+{
+    srs::shared_resources<all> resources(1, 'a', 2L, short{ 3 });
+    std::atomic<int> count = 0;
+    srs::par_for_each(resources, [&](auto &value) {
+        add_one{}(value);
+        ++count;
+    });
+    EXPECT_EQ(count, 4);
+    EXPECT_EQ(resources.get<int>(), 2);
+    EXPECT_EQ(resources.get<char>(), 'b');
+    EXPECT_EQ(resources.get<long>(), 3L);
+    EXPECT_EQ(resources.get<short>(), 4);
+
+    srs::par_for_each(resources, add_one{}, 1);
+    EXPECT_EQ(resources.get<int>(), 3);
+}
+
+TEST(for_each_test, parallel_exception)
+{
+    srs::shared_resources<all> resources(1, 'a', 2L, short{ 3 });
+    auto throw_on_long = [](auto &value) {
+        if constexpr (std::is_same_v<std::remove_reference_t<decltype(value)>, long>)
+        {
+            throw std::runtime_error("long");
+        }
+    };
+    EXPECT_THROW(srs::par_for_each(resources, throw_on_long, 4), std::runtime_error);
+}
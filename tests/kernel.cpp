@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <shared_resources/kernel.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+///
+/// @brief A function table with one variant per instruction set level
+///
+struct sum_kernels
+{
+    int (*sum)(int const *values, std::size_t size);
+    srs::isa (*level)();
+};
+
+int sum_baseline(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+__attribute__((target("avx2"))) int sum_avx2(int const *values, std::size_t size)
+{
+    int total = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        total += values[i];
+    }
+    return total;
+}
+#else
+int sum_avx2(int const *values, std::size_t size)
+{
+    return sum_baseline(values, size);
+}
+#endif
+
+sum_kernels const baseline{ &sum_baseline, [] { return srs::isa::baseline; } };
+sum_kernels const avx2{ &sum_avx2, [] { return srs::isa::avx2; } };
+sum_kernels const avx512{ &sum_baseline, [] { return srs::isa::avx512; } };
+}  // namespace
+
+TEST(kernel_test, select)
+{
+    EXPECT_EQ(srs::kernel<sum_kernels>(baseline, { { srs::isa::avx2, avx2 }, { srs::isa::avx512, avx512 } }, srs::isa::sse2).level(), srs::isa::baseline);
+    EXPECT_EQ(srs::kernel<sum_kernels>(baseline, { { srs::isa::avx512, avx512 }, { srs::isa::avx2, avx2 } }, srs::isa::avx2).get().level(), srs::isa::avx2);
+    EXPECT_EQ(srs::kernel<sum_kernels>(baseline, { { srs::isa::avx2, avx2 }, { srs::isa::avx512, avx512 } }, srs::isa::avx512).level(), srs::isa::avx512);
+}
+
+TEST(kernel_test, host)
+{
+    using kernels = srs::kernel<sum_kernels>;
+    srs::shared_resources<srs::type_list<kernels, int>> resources(kernels(baseline, { { srs::isa::avx2, avx2 }, { srs::isa::avx512, avx512 } }), 0);
+
+    sum_kernels const &selected = resources.get<sum_kernels>();
+    EXPECT_LE(selected.level(), srs::host_isa());
+    EXPECT_EQ(selected.level(), resources.get<kernels>().level());
+
+    std::vector<int> const values{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    EXPECT_EQ(selected.sum(values.data(), values.size()), 45);
+}
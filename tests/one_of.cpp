@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <shared_resources/one_of.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+struct zstd
+{
+    int level;
+
+    int compress(int block) const
+    {
+        return block * level;
+    }
+};
+
+struct lz4
+{
+    int compress(int block) const
+    {
+        return block + 4;
+    }
+};
+
+struct snappy
+{
+    int compress(int block) const
+    {
+        return block;
+    }
+};
+
+template <int N>
+struct hasher
+{
+    int hash() const
+    {
+        return N;
+    }
+};
+
+using codec  = srs::one_of<zstd, lz4, snappy>;
+using hashes = srs::one_of<hasher<0>, hasher<1>, hasher<2>, hasher<3>, hasher<4>, hasher<5>>;
+}  // namespace
+
+TEST(one_of_test, branch_chain)
+{
+    codec slot(lz4{});
+    EXPECT_EQ(slot.index(), 1u);
+    EXPECT_TRUE(slot.holds<lz4>());
+    EXPECT_EQ(slot.visit([](auto const &impl) { return impl.compress(1); }), 5);
+
+    slot.emplace<zstd>(3);
+    codec const &constant = slot;
+    EXPECT_EQ(constant.visit([](auto const &impl) { return impl.compress(2); }), 6);
+
+    int calls = 0;
+    slot.visit([&](auto &) { ++calls; });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(one_of_test, jump_table)
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        hashes slot(hasher<0>{});
+        switch (i)
+        {
+        case 1: slot.emplace<hasher<1>>(); break;
+        case 2: slot.emplace<hasher<2>>(); break;
+        case 3: slot.emplace<hasher<3>>(); break;
+        case 4: slot.emplace<hasher<4>>(); break;
+        case 5: slot.emplace<hasher<5>>(); break;
+        default: break;
+        }
+        EXPECT_EQ(slot.visit([](auto const &impl) { return impl.hash(); }), i);
+    }
+}
+
+TEST(one_of_test, bundle)
+{
+    srs::shared_resources<srs::type_list<codec, std::string>> resources(codec(std::in_place_type<zstd>, 2), std::string("name"));
+    EXPECT_EQ(srs::visit<codec>(resources, [](auto &impl) { return impl.compress(5); }), 10);
+    EXPECT_EQ(resources.visit<codec>([](auto &impl) { return impl.compress(6); }), 12);
+    auto const &constant = resources;
+    EXPECT_EQ(constant.visit<codec>([](auto const &impl) { return impl.compress(7); }), 14);
+
+    std::vector<int> const blocks{ 1, 2, 3 };
+    std::vector<int> compressed;
+    srs::visit_each<codec>(resources, blocks, [&](auto &impl, int block) { compressed.push_back(impl.compress(block)); });
+    EXPECT_EQ(compressed, (std::vector<int>{ 2, 4, 6 }));
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <shared_resources/optional_resources.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+struct tracer
+{
+    std::string name;
+};
+
+using bundle = srs::optional_resources<srs::type_list<int, srs::maybe<std::string>, srs::maybe<tracer>, srs::maybe<std::shared_ptr<int>>>>;
+}  // namespace
+
+TEST(optional_resources_test, presence)
+{
+    static_assert(std::is_same_v<bundle::resource_list, srs::type_list<int>>);
+    static_assert(std::is_same_v<bundle::optional_list, srs::type_list<std::string, tracer, std::shared_ptr<int>>>);
+
+    bundle resources(1, std::string("name"));
+    EXPECT_EQ(resources.get<int>(), 1);
+    EXPECT_TRUE(resources.has<std::string>());
+    EXPECT_FALSE((resources.has<std::string, tracer>()));
+    EXPECT_EQ(*resources.try_get<std::string>(), "name");
+    EXPECT_EQ(resources.try_get<tracer>(), nullptr);
+    EXPECT_EQ(resources.presence(), 0b001u);
+
+    resources.emplace<tracer>("trace");
+    EXPECT_TRUE((resources.has<std::string, tracer>()));
+    EXPECT_EQ(resources.try_get<tracer>()->name, "trace");
+
+    resources.reset<std::string>();
+    EXPECT_FALSE(resources.has<std::string>());
+    EXPECT_EQ(resources.presence(), 0b010u);
+}
+
+TEST(optional_resources_test, copy_and_move)
+{
+    auto shared = std::make_shared<int>(5);
+    bundle resources(1, shared);
+    EXPECT_EQ(shared.use_count(), 2);
+
+    {
+        bundle copy(resources);
+        EXPECT_EQ(shared.use_count(), 3);
+        EXPECT_EQ(**copy.try_get<std::shared_ptr<int>>(), 5);
+
+        bundle moved(std::move(copy));
+        EXPECT_EQ(shared.use_count(), 3);
+        EXPECT_EQ(**moved.try_get<std::shared_ptr<int>>(), 5);
+
+        moved = resources;
+        EXPECT_EQ(shared.use_count(), 3);
+        moved.reset<std::shared_ptr<int>>();
+        EXPECT_EQ(shared.use_count(), 2);
+        moved = std::move(resources);
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(optional_resources_test, move_noexcept)
+{
+    struct throwing_move
+    {
+        throwing_move() = default;
+        throwing_move(throwing_move const &) = default;
+
+        throwing_move(throwing_move &&) noexcept(false)
+        {
+        }
+    };
+
+    // Moves are noexcept only if moving every resource is
+    static_assert(std::is_nothrow_move_constructible_v<bundle>);
+    static_assert(std::is_nothrow_move_assignable_v<bundle>);
+
+    using throwing = srs::optional_resources<srs::type_list<int, srs::maybe<throwing_move>>>;
+    static_assert(!std::is_nothrow_move_constructible_v<throwing>);
+    static_assert(!std::is_nothrow_move_assignable_v<throwing>);
+
+    throwing resources(1, throwing_move{});
+    throwing moved(std::move(resources));
+    EXPECT_TRUE(moved.has<throwing_move>());
+}
+
+TEST(optional_resources_test, throwing_copy_destroys_constructed)
+{
+    static int live = 0;
+    static bool fail = false;
+
+    struct counted
+    {
+        counted()
+        {
+            ++live;
+        }
+
+        counted(counted const &)
+        {
+            ++live;
+        }
+
+        ~counted()
+        {
+            --live;
+        }
+    };
+
+    struct throwing_copy
+    {
+        throwing_copy() = default;
+
+        throwing_copy(throwing_copy const &)
+        {
+            if (fail)
+            {
+                throw 1;
+            }
+        }
+    };
+
+    using throwing = srs::optional_resources<srs::type_list<int, srs::maybe<counted>, srs::maybe<throwing_copy>>>;
+
+    {
+        throwing resources(1, counted{}, throwing_copy{});
+        EXPECT_EQ(live, 1);
+
+        // The optional resources constructed before the throw are destroyed
+        fail = true;
+        EXPECT_ANY_THROW(throwing copy(resources));
+        EXPECT_EQ(live, 1);
+        EXPECT_ANY_THROW(throwing constructed(1, counted{}, throwing_copy{}));
+        EXPECT_EQ(live, 1);
+        fail = false;
+    }
+    EXPECT_EQ(live, 0);
+}
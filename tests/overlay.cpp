@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <shared_resources/child_resources.hpp>
+#include <shared_resources/for_each.hpp>
+#include <shared_resources/overlay.hpp>
+
+#include <string>
+
+namespace
+{
+using all = srs::type_list<int, char, std::string>;
+}  // namespace
+
+TEST(overlay_test, get)
+{
+    srs::shared_resources<all> resources(1, 'a', std::string("base"));
+    std::string replacement = "override";
+    srs::overlay view(resources, replacement);
+    EXPECT_EQ(view.get<std::string>(), "override");
+    EXPECT_EQ(&view.get<std::string>(), &replacement);
+    EXPECT_EQ(&view.get<int>(), &resources.get<int>());
+    EXPECT_EQ(resources.get<std::string>(), "base");
+
+    view.get<char>() = 'b';
+    EXPECT_EQ(resources.get<char>(), 'b');
+
+    int count = 0;
+    srs::for_each(view, [&](auto const &) { ++count; });
+    EXPECT_EQ(count, 3);
+}
+
+TEST(overlay_test, nested)
+{
+    int a = 1;
+    char b = 'a';
+    std::string c = "base";
+    srs::shared_references<all> const references(a, b, c);
+    int other = 2;
+    srs::overlay view(references, other);
+    srs::child_resources<decltype(view) const, srs::type_list<double>> child(view, 0.5);
+    EXPECT_EQ(child.get<int>(), 2);
+    EXPECT_EQ(child.get<std::string>(), "base");
+    EXPECT_EQ(child.get<double>(), 0.5);
+}
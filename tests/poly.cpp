@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <shared_resources/poly.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+struct codec
+{
+    virtual ~codec() = default;
+
+    virtual std::string name() const = 0;
+};
+
+struct small_codec
+    : public codec
+{
+    std::string name() const override
+    {
+        return "small";
+    }
+};
+
+struct large_codec
+    : public codec
+{
+    explicit large_codec(std::shared_ptr<int> counter)
+        : counter(std::move(counter))
+    {
+    }
+
+    std::string name() const override
+    {
+        return "large";
+    }
+
+    std::shared_ptr<int> counter;
+    std::array<char, 256> table{};
+};
+
+using slot = srs::poly<codec>;
+}  // namespace
+
+TEST(poly_test, inline_and_heap)
+{
+    slot small(small_codec{});
+    EXPECT_TRUE(small.is_inline());
+    EXPECT_EQ(small.get().name(), "small");
+
+    auto counter = std::make_shared<int>(0);
+    slot large(std::in_place_type<large_codec>, counter);
+    EXPECT_FALSE(large.is_inline());
+    EXPECT_EQ(large.get().name(), "large");
+    EXPECT_EQ(counter.use_count(), 2);
+
+    slot copy(large);
+    EXPECT_EQ(counter.use_count(), 3);
+    EXPECT_NE(&copy.get(), &large.get());
+
+    slot moved(std::move(copy));
+    EXPECT_EQ(counter.use_count(), 3);
+    EXPECT_EQ(moved.get().name(), "large");
+
+    moved = small;
+    EXPECT_EQ(counter.use_count(), 2);
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(moved.get().name(), "small");
+
+    moved.emplace<large_codec>(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+}
+
+TEST(poly_test, get_base)
+{
+    srs::shared_resources<srs::type_list<slot, int>> resources(slot(small_codec{}), 1);
+    static_assert(std::is_same_v<decltype(resources.get<codec>()), codec &>);
+    EXPECT_EQ(resources.get<codec>().name(), "small");
+    EXPECT_EQ(&resources.get<codec>(), &resources.get<slot>().get());
+
+    resources.get<slot>().emplace<large_codec>(nullptr);
+    EXPECT_EQ(resources.get<codec>().name(), "large");
+
+    auto const copy = resources;
+    EXPECT_EQ(copy.get<codec>().name(), "large");
+}
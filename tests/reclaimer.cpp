@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <shared_resources/concurrent_resources.hpp>
+#include <shared_resources/reclaimer.hpp>
+#include <shared_resources/registry.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace
+{
+///
+/// @brief Records the thread that destroyed it
+///
+struct heavy
+{
+    explicit heavy(std::atomic<std::thread::id> *destroyed_by = nullptr)
+        : destroyed_by(destroyed_by)
+    {
+    }
+
+    heavy(heavy &&other) noexcept
+        : destroyed_by(std::exchange(other.destroyed_by, nullptr))
+    {
+    }
+
+    heavy(heavy const &)            = default;
+    heavy &operator=(heavy const &) = default;
+
+    heavy &operator=(heavy &&other) noexcept
+    {
+        destroyed_by = std::exchange(other.destroyed_by, nullptr);
+        return *this;
+    }
+
+    ~heavy()
+    {
+        if (destroyed_by != nullptr)
+        {
+            destroyed_by->store(std::this_thread::get_id());
+        }
+    }
+
+    std::atomic<std::thread::id> *destroyed_by;
+};
+}  // namespace
+
+TEST(reclaimer_test, retire)
+{
+    std::atomic<std::thread::id> first;
+    std::atomic<std::thread::id> second;
+    std::atomic<std::thread::id> third;
+
+    srs::reclaimer background(2);
+    background.retire(std::make_unique<heavy>(&first));
+    background.retire(std::make_shared<heavy>(&second));
+    background.retire(heavy(&third));
+    background.drain();
+
+    EXPECT_NE(first.load(), std::thread::id());
+    EXPECT_NE(first.load(), std::this_thread::get_id());
+    EXPECT_EQ(second.load(), first.load());
+    EXPECT_EQ(third.load(), first.load());
+}
+
+TEST(reclaimer_test, replace_and_teardown)
+{
+    std::atomic<std::thread::id> replaced;
+    std::atomic<std::thread::id> torn_down;
+
+    srs::reclaimer background;
+    srs::shared_resources<srs::type_list<heavy, int>> resources(heavy(&replaced), 1);
+    srs::replace(resources, heavy(&torn_down), background);
+    background.drain();
+    EXPECT_NE(replaced.load(), std::thread::id());
+    EXPECT_NE(replaced.load(), std::this_thread::get_id());
+
+    background.retire(std::move(resources));
+    background.drain();
+    EXPECT_EQ(torn_down.load(), replaced.load());
+}
+
+TEST(reclaimer_test, concurrent_resources)
+{
+    std::atomic<std::thread::id> replaced;
+    std::atomic<std::thread::id> torn_down;
+
+    srs::reclaimer background;
+    {
+        srs::concurrent_resources<srs::type_list<heavy, int>> resources(heavy(&replaced), 1);
+        resources.defer_destruction(background);
+        resources.store(heavy(&torn_down));
+        resources.store(2);
+    }
+    background.drain();
+    EXPECT_NE(replaced.load(), std::thread::id());
+    EXPECT_NE(replaced.load(), std::this_thread::get_id());
+    EXPECT_EQ(torn_down.load(), replaced.load());
+}
+
+TEST(reclaimer_test, registry)
+{
+    std::atomic<std::thread::id> erased;
+    std::atomic<std::thread::id> torn_down;
+
+    srs::reclaimer background;
+    {
+        srs::registry<int, heavy> tenants([&](int id) { return heavy(id == 1 ? &erased : &torn_down); });
+        tenants.defer_destruction(background);
+        tenants.read().get(1);
+        tenants.read().get(2);
+        tenants.erase(1);
+    }
+    background.drain();
+    EXPECT_NE(erased.load(), std::thread::id());
+    EXPECT_NE(erased.load(), std::this_thread::get_id());
+    EXPECT_EQ(torn_down.load(), erased.load());
+}
+
+TEST(reclaimer_test, full_queue)
+{
+    std::atomic<bool> release{ false };
+    struct blocker
+    {
+        std::atomic<bool> *release;
+
+        ~blocker()
+        {
+            while (!release->load())
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // The background thread is stuck destroying the blocker and the one slot of the queue is taken
+    srs::reclaimer background(1);
+    background.retire(std::make_unique<blocker>(&release));
+    std::atomic<std::thread::id> queued;
+    auto                         pending = std::make_unique<heavy>(&queued);
+    while (!background.try_retire(pending.get(), [](void *object) noexcept { delete static_cast<heavy *>(object); }))
+    {
+        std::this_thread::yield();
+    }
+    pending.release();
+    EXPECT_FALSE(background.try_retire(nullptr, [](void *) noexcept {}));
+
+    // Writers do not wait for room; what the reclaimer cannot take is destroyed inline
+    std::atomic<std::thread::id> replaced;
+    {
+        srs::concurrent_resources<srs::type_list<heavy, int>> resources(heavy(&replaced), 1);
+        resources.defer_destruction(background);
+        resources.store(heavy());
+        resources.store(2);
+        resources.store(3);
+        EXPECT_EQ(replaced.load(), std::this_thread::get_id());
+    }
+
+    release.store(true);
+    background.drain();
+    EXPECT_NE(queued.load(), std::thread::id());
+    EXPECT_NE(queued.load(), std::this_thread::get_id());
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <shared_resources/registry.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using tenant = srs::shared_resources<srs::type_list<int, long>>;
+}  // namespace
+
+TEST(registry_test, get)
+{
+    int created = 0;
+    srs::registry<int, tenant> tenants([&](int id) {
+        ++created;
+        return tenant(id, 10L * id);
+    });
+
+    {
+        auto guard = tenants.read();
+        EXPECT_EQ(guard.find(1), nullptr);
+        EXPECT_EQ(guard.get(1).get<long>(), 10L);
+        EXPECT_EQ(guard.find(1), &guard.get(1));
+        for (int id = 2; id < 100; ++id)
+        {
+            EXPECT_EQ(guard.get(id).get<int>(), id);
+        }
+        EXPECT_EQ(guard.find(1)->get<int>(), 1);
+    }
+    EXPECT_EQ(created, 99);
+    EXPECT_EQ(tenants.size(), 99u);
+
+    EXPECT_TRUE(tenants.erase(1));
+    EXPECT_FALSE(tenants.erase(1));
+    EXPECT_EQ(tenants.read().find(1), nullptr);
+    EXPECT_EQ(tenants.read().find(2)->get<int>(), 2);
+    EXPECT_EQ(tenants.size(), 98u);
+}
+
+TEST(registry_test, concurrent)
+{
+    srs::registry<unsigned, tenant> tenants([](unsigned id) { return tenant(static_cast<int>(id), 1L); }, 4);
+    std::atomic<bool> failed = false;
+
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&, t] {
+            for (unsigned i = 0; i < 2000; ++i)
+            {
+                unsigned const id = (i * 7 + t) % 500;
+                auto guard        = tenants.read();
+                if (guard.get(id).get<int>() != static_cast<int>(id))
+                {
+                    failed = true;
+                }
+            }
+        });
+    }
+    std::thread eraser([&] {
+        for (unsigned i = 0; i < 2000; ++i)
+        {
+            tenants.erase(i % 500);
+        }
+    });
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+    eraser.join();
+    EXPECT_FALSE(failed);
+}
@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
 #include <shared_resources/shared_resources.hpp>
 
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 using all      = srs::type_list<int, char, int *, char *>;
 using shuffled = srs::type_list<char *, int, char, int *>;
 using extra    = srs::type_list<int, char *, char **, int *, char>;
@@ -76,3 +83,222 @@ TEST(shared_resources_test, references)
     delete c;
     delete d;
 }
+
+TEST(shared_resources_test, find)
+{
+    int a   = 1;
+    char b  = 'a';
+    int *c  = nullptr;
+    char *d = nullptr;
+    srs::shared_resources<all, char *> resources(a, b, c);
+    EXPECT_EQ(resources.find(srs::type_id_of<int>), &resources.get<int>());
+    EXPECT_EQ(resources.find(srs::type_id_of<char>), &resources.get<char>());
+    EXPECT_EQ(resources.find(srs::type_id_of<int *>), &resources.get<int *>());
+    EXPECT_EQ(resources.find(srs::type_id_of<char *>), nullptr);
+    EXPECT_EQ(resources.find(srs::type_id_of<long>), nullptr);
+
+    srs::shared_references<all> references(a, b, c, d);
+    EXPECT_EQ(references.find(srs::type_id_of<int>), &a);
+    EXPECT_EQ(references.find(srs::type_id_of<char *>), &d);
+    EXPECT_EQ(references.find(srs::type_id_of<double>), nullptr);
+}
+
+namespace
+{
+class storage_interface
+{
+public:
+    virtual ~storage_interface() = default;
+
+    virtual std::string read(std::string const &key) const = 0;
+    virtual void write(std::string const &key, std::string const &value) = 0;
+};
+
+class memory_storage
+    : public storage_interface
+{
+public:
+    explicit memory_storage(std::string prefix)
+        : prefix_(std::move(prefix))
+    {
+    }
+
+    std::string read(std::string const &key) const override
+    {
+        auto const found = values_.find(key);
+        return found != values_.end() ? prefix_ + found->second : std::string();
+    }
+
+    void write(std::string const &key, std::string const &value) override
+    {
+        values_[key] = value;
+    }
+
+private:
+    std::string prefix_;
+    std::map<std::string, std::string> values_;
+};
+
+class null_storage final
+    : public storage_interface
+{
+public:
+    std::string read(std::string const &) const override
+    {
+        return "null";
+    }
+
+    void write(std::string const &, std::string const &) override
+    {
+    }
+};
+
+///
+/// @brief Generic code written against the interface
+///
+template <typename Bundle>
+std::string round_trip(Bundle &bundle)
+{
+    auto &storage = bundle.template get<storage_interface>();
+    storage.write("key", "value");
+    return storage.read("key");
+}
+}  // namespace
+
+TEST(shared_resources_test, get_interface)
+{
+    using memory_bundle = srs::shared_resources<srs::type_list<srs::implements<storage_interface, memory_storage>, int>>;
+    memory_bundle resources(srs::implements<storage_interface, memory_storage>("memory:"), 1);
+
+    // The implementation is returned through a final type, so calls need no virtual dispatch
+    using returned = std::remove_reference_t<decltype(resources.get<storage_interface>())>;
+    static_assert(std::is_final_v<returned>);
+    static_assert(std::is_base_of_v<memory_storage, returned>);
+    EXPECT_EQ(round_trip(resources), "memory:value");
+
+    memory_bundle const copy = resources;
+    EXPECT_EQ(copy.get<storage_interface>().read("key"), "memory:value");
+
+    using null_bundle = srs::shared_resources<srs::type_list<srs::implements<storage_interface, null_storage>>>;
+    null_bundle other{ srs::implements<storage_interface, null_storage>() };
+    static_assert(std::is_same_v<decltype(other.get<storage_interface>()), null_storage &>);
+    EXPECT_EQ(round_trip(other), "null");
+}
+
+namespace
+{
+struct logger
+{
+    virtual ~logger() = default;
+
+    virtual std::string name() const
+    {
+        return "logger";
+    }
+};
+
+struct fast_logger
+    : public logger
+{
+    std::string name() const override
+    {
+        return "fast_logger";
+    }
+};
+}  // namespace
+
+TEST(shared_resources_test, get_base)
+{
+    srs::shared_resources<srs::type_list<fast_logger, int>> resources(fast_logger{}, 1);
+    logger &base = resources.get<logger>();
+    EXPECT_EQ(&base, &resources.get<fast_logger>());
+    EXPECT_EQ(base.name(), "fast_logger");
+    static_assert(std::is_same_v<decltype(resources.get<logger>()), fast_logger &>);
+    static_assert(std::is_same_v<decltype(std::as_const(resources).get<logger>()), fast_logger const &>);
+
+    auto const &constant = resources;
+    EXPECT_EQ(&constant.get<logger>(), &base);
+
+    // A stored base takes precedence over derived resources
+    srs::shared_resources<srs::type_list<logger, fast_logger>> both(logger{}, fast_logger{});
+    EXPECT_EQ(both.get<logger>().name(), "logger");
+}
+
+namespace
+{
+struct handle
+{
+    int *get() const
+    {
+        ++calls;
+        return nullptr;
+    }
+
+    inline static int calls = 0;
+};
+}  // namespace
+
+TEST(shared_resources_test, prefetch)
+{
+    int                   target = 7;
+    auto                  shared = std::make_shared<std::string>("shared");
+    std::array<char, 256> large{};
+    srs::shared_resources<srs::type_list<int *, std::shared_ptr<std::string>, std::array<char, 256>, double>> resources(
+        &target, shared, large, 1.5);
+
+    resources.prefetch<int *, std::shared_ptr<std::string>>();
+    resources.prefetch<std::array<char, 256>>();
+    resources.prefetch_all();
+    EXPECT_EQ(resources.get<int *>(), &target);
+    EXPECT_EQ(*resources.get<std::shared_ptr<std::string>>(), "shared");
+    EXPECT_EQ(resources.get<double>(), 1.5);
+
+    // Null pointers are not followed
+    int *null = nullptr;
+    srs::shared_resources<srs::type_list<int *>> empty(null);
+    empty.prefetch_all();
+
+    double value = 2.5;
+    srs::shared_references<srs::type_list<int, double>> references(target, value);
+    references.prefetch<double>();
+    references.prefetch_all();
+    EXPECT_EQ(references.get<int>(), 7);
+
+    // A get() of a type that is not a known pointer type is never called
+    srs::shared_resources<srs::type_list<handle, std::unique_ptr<int>>> others(srs::in_order, handle{}, std::make_unique<int>(3));
+    others.prefetch_all();
+    EXPECT_EQ(handle::calls, 0);
+}
+
+namespace
+{
+struct list_only
+{
+    using resource_list = srs::type_list<int>;
+};
+
+struct int_provider
+{
+    using resource_list = srs::type_list<int>;
+
+    template <typename T>
+    T &get() noexcept
+    {
+        return value;
+    }
+
+    int value = 0;
+};
+}  // namespace
+
+TEST(shared_resources_test, bundle_concept)
+{
+    static_assert(srs::bundle_concept<srs::shared_resources<srs::type_list<int, char>>>);
+    static_assert(srs::bundle_concept<srs::shared_references<srs::type_list<int, char>> const>);
+    static_assert(srs::bundle_concept<int_provider>);
+
+    // resource_list alone is not enough; every listed type must be reachable through get<T>()
+    static_assert(!srs::bundle_concept<list_only>);
+    static_assert(!srs::bundle_concept<int_provider const>);
+    static_assert(!srs::bundle_concept<int>);
+}
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+#include <shared_resources/versioned_resources.hpp>
+
+#include <string>
+
+namespace
+{
+using all = srs::type_list<int, char, std::string>;
+}  // namespace
+
+TEST(versioned_resources_test, generations)
+{
+    srs::versioned_resources<all, char> resources(1, std::string("a"));
+    EXPECT_EQ(resources.version(), 0u);
+
+    resources.get<int>() = 2;
+    EXPECT_EQ(resources.generation<int>(), 1u);
+    EXPECT_EQ(resources.generation<std::string>(), 0u);
+
+    auto const &const_resources = resources;
+    EXPECT_EQ(const_resources.get<int>(), 2);
+    EXPECT_EQ(resources.generation<int>(), 1u);
+
+    resources.touch<std::string>();
+    resources.touch<std::string>();
+    EXPECT_EQ(resources.generations(), (std::array<std::uint64_t, 2>{ 1, 2 }));
+    EXPECT_EQ(resources.version(), 3u);
+    EXPECT_EQ(resources.resources().get<std::string>(), "a");
+}